@@ -393,6 +393,138 @@ const char bundle1[] = {
 };
 
 const char bundle2[] = {
+    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6E, 0x61, 0x6D, 
+    0x65, 0x22, 0x3A, 0x20, 0x22, 0x43, 0x53, 0x53, 0x22, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x78, 0x74, 0x65, 
+    0x6E, 0x73, 0x69, 0x6F, 0x6E, 0x73, 0x22, 0x3A, 0x20, 0x5B, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
+    0x2E, 0x63, 0x73, 0x73, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6D, 0x75, 
+    0x6C, 0x74, 0x69, 0x6C, 0x69, 0x6E, 0x65, 0x2D, 0x63, 0x6F, 
+    0x6D, 0x6D, 0x65, 0x6E, 0x74, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x2F, 
+    0x2A, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x2A, 0x2F, 0x22, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6B, 
+    0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x73, 0x31, 0x22, 0x3A, 
+    0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x22, 0x40, 0x6D, 0x65, 0x64, 0x69, 0x61, 0x22, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
+    0x40, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x40, 
+    0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x66, 0x61, 0x63, 0x65, 0x22, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x40, 0x6B, 0x65, 0x79, 0x66, 0x72, 0x61, 0x6D, 0x65, 
+    0x73, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x40, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 
+    0x74, 0x73, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x40, 0x70, 0x61, 0x67, 0x65, 0x22, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x40, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65, 0x74, 0x22, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x21, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6E, 
+    0x74, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x6B, 0x65, 0x79, 0x77, 0x6F, 
+    0x72, 0x64, 0x73, 0x32, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x6F, 
+    0x6C, 0x6F, 0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x62, 0x61, 0x63, 0x6B, 0x67, 
+    0x72, 0x6F, 0x75, 0x6E, 0x64, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x62, 0x61, 0x63, 
+    0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 
+    0x6C, 0x6F, 0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x62, 0x6F, 0x72, 0x64, 0x65, 
+    0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x22, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x22, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
+    0x77, 0x69, 0x64, 0x74, 0x68, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x68, 0x65, 0x69, 
+    0x67, 0x68, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x64, 0x69, 0x73, 0x70, 0x6C, 
+    0x61, 0x79, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 
+    0x6F, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x74, 0x6F, 0x70, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6C, 
+    0x65, 0x66, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 
+    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x22, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x22, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
+    0x66, 0x6F, 0x6E, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 0x6F, 0x6E, 0x74, 
+    0x2D, 0x73, 0x69, 0x7A, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 0x6F, 0x6E, 
+    0x74, 0x2D, 0x66, 0x61, 0x6D, 0x69, 0x6C, 0x79, 0x22, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
+    0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x77, 0x65, 0x69, 0x67, 0x68, 
+    0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x61, 0x6C, 
+    0x69, 0x67, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x6C, 0x69, 0x6E, 0x65, 0x2D, 
+    0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 0x6C, 
+    0x65, 0x78, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x67, 0x72, 0x69, 0x64, 0x22, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
+    0x6F, 0x76, 0x65, 0x72, 0x66, 0x6C, 0x6F, 0x77, 0x22, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
+    0x6F, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 
+    0x72, 0x61, 0x6E, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x22, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 
+    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x22, 0x7A, 0x2D, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x22, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x22, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
+    0x63, 0x75, 0x72, 0x73, 0x6F, 0x72, 0x22, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 
+    0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x73, 0x33, 0x22, 
+    0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x6E, 0x6F, 0x6E, 0x65, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x61, 
+    0x75, 0x74, 0x6F, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 
+    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x22, 0x69, 0x6E, 0x6C, 0x69, 0x6E, 0x65, 0x22, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
+    0x69, 0x6E, 0x6C, 0x69, 0x6E, 0x65, 0x2D, 0x62, 0x6C, 0x6F, 
+    0x63, 0x6B, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x61, 0x62, 0x73, 0x6F, 0x6C, 0x75, 
+    0x74, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 
+    0x76, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x66, 0x69, 0x78, 0x65, 0x64, 0x22, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x73, 0x6F, 0x6C, 0x69, 0x64, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x62, 0x6F, 
+    0x6C, 0x64, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 
+    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x22, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6E, 0x22, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
+    0x69, 0x6E, 0x68, 0x65, 0x72, 0x69, 0x74, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 
+    0x6E, 0x69, 0x74, 0x69, 0x61, 0x6C, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x70, 0x78, 
+    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x22, 0x65, 0x6D, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x72, 0x65, 0x6D, 0x22, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x72, 0x67, 0x62, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x72, 0x67, 0x62, 0x61, 
+    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x22, 0x76, 0x61, 0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x61, 0x6C, 
+    0x63, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 0x0A, 0x7D, 
+    0x0A, 0x00, 
+};
+
+const char bundle3[] = {
     0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6E, 0x61, 0x6D, 
     0x65, 0x22, 0x3A, 0x20, 0x22, 0x47, 0x6F, 0x22, 0x2C, 0x0A, 
     0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x78, 0x74, 0x65, 0x6E, 
@@ -407,122 +539,134 @@ const char bundle2[] = {
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x2F, 0x2A, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
     0x20, 0x22, 0x2A, 0x2F, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6B, 0x65, 
-    0x79, 0x77, 0x6F, 0x72, 0x64, 0x73, 0x31, 0x22, 0x3A, 0x20, 
-    0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x61, 
-    0x73, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 
-    0x75, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 
-    0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x64, 0x65, 0x66, 0x65, 0x72, 0x22, 0x2C, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x65, 0x6C, 0x73, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 0x61, 0x6C, 0x6C, 
-    0x74, 0x68, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 
-    0x6F, 0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x67, 0x6F, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x67, 0x6F, 
-    0x74, 0x6F, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x69, 0x66, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x72, 0x61, 
-    0x6E, 0x67, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x72, 0x65, 0x74, 0x75, 0x72, 
-    0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x22, 
-    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x22, 0x0A, 0x20, 
+    0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x72, 0x65, 
+    0x67, 0x69, 0x6F, 0x6E, 0x73, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x73, 0x74, 0x61, 0x72, 0x74, 0x22, 0x3A, 
+    0x20, 0x22, 0x60, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 
+    0x6E, 0x64, 0x22, 0x3A, 0x20, 0x22, 0x60, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x3A, 0x20, 
+    0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 
     0x20, 0x20, 0x20, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x73, 0x32, 
+    0x22, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x73, 0x31, 
     0x22, 0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x63, 0x68, 0x61, 0x6E, 0x22, 0x2C, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x63, 0x6F, 0x6E, 0x73, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 0x75, 0x6E, 
-    0x63, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x22, 
+    0x20, 0x20, 0x20, 0x22, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x22, 
     0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x66, 0x61, 0x63, 0x65, 
+    0x22, 0x63, 0x61, 0x73, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x6F, 0x6E, 
+    0x74, 0x69, 0x6E, 0x75, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x64, 0x65, 0x66, 
+    0x61, 0x75, 0x6C, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x64, 0x65, 0x66, 0x65, 
+    0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x65, 0x6C, 0x73, 0x65, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 
+    0x61, 0x6C, 0x6C, 0x74, 0x68, 0x72, 0x6F, 0x75, 0x67, 0x68, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x6D, 0x61, 0x70, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x70, 0x61, 0x63, 
-    0x6B, 0x61, 0x67, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x74, 0x72, 0x75, 
+    0x20, 0x22, 0x66, 0x6F, 0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x67, 0x6F, 0x22, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x67, 0x6F, 0x74, 0x6F, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x66, 0x22, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x65, 0x6C, 0x65, 
     0x63, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x2C, 
+    0x20, 0x20, 0x20, 0x22, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 
+    0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 
+    0x64, 0x73, 0x32, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x68, 0x61, 
+    0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x22, 0x2C, 
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x76, 0x61, 0x72, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 
-    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6B, 0x65, 0x79, 
-    0x77, 0x6F, 0x72, 0x64, 0x73, 0x33, 0x22, 0x3A, 0x20, 0x5B, 
+    0x66, 0x75, 0x6E, 0x63, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x6D, 0x70, 0x6F, 
+    0x72, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x66, 
+    0x61, 0x63, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x6D, 0x61, 0x70, 0x22, 0x2C, 
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x62, 0x6F, 0x6F, 0x6C, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x62, 0x79, 0x74, 0x65, 
-    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x78, 0x36, 
+    0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 
+    0x74, 0x72, 0x75, 0x63, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 
+    0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x76, 0x61, 0x72, 0x22, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 
+    0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x73, 0x33, 0x22, 
+    0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x62, 0x6F, 0x6F, 0x6C, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x62, 
+    0x79, 0x74, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 
+    0x65, 0x78, 0x36, 0x34, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x6F, 0x6D, 0x70, 
+    0x6C, 0x65, 0x78, 0x31, 0x32, 0x38, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x72, 
+    0x72, 0x6F, 0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 0x6C, 0x6F, 0x61, 0x74, 
+    0x33, 0x32, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x36, 
     0x34, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x78, 
-    0x31, 0x32, 0x38, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x72, 0x72, 0x6F, 0x72, 
-    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x33, 0x32, 0x22, 
-    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x36, 0x34, 0x22, 0x2C, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x69, 0x6E, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x6E, 0x74, 0x38, 0x22, 
+    0x20, 0x20, 0x22, 0x69, 0x6E, 0x74, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x6E, 
+    0x74, 0x38, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x69, 0x6E, 0x74, 0x31, 0x36, 0x22, 
     0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x69, 0x6E, 0x74, 0x31, 0x36, 0x22, 0x2C, 0x0A, 0x20, 
+    0x22, 0x69, 0x6E, 0x74, 0x33, 0x32, 0x22, 0x2C, 0x0A, 0x20, 
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x6E, 
-    0x74, 0x33, 0x32, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x6E, 0x74, 0x36, 0x34, 
-    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x72, 0x75, 0x6E, 0x65, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x74, 
-    0x72, 0x69, 0x6E, 0x67, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x75, 0x69, 0x6E, 0x74, 
-    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x75, 0x69, 0x6E, 0x74, 0x38, 0x22, 0x2C, 0x0A, 
+    0x74, 0x36, 0x34, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x72, 0x75, 0x6E, 0x65, 0x22, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x2C, 0x0A, 
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x75, 
-    0x69, 0x6E, 0x74, 0x31, 0x36, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x75, 0x69, 0x6E, 
-    0x74, 0x33, 0x32, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x75, 0x69, 0x6E, 0x74, 0x36, 
-    0x34, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x75, 0x69, 0x6E, 0x74, 0x70, 0x74, 0x72, 
+    0x69, 0x6E, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x75, 0x69, 0x6E, 0x74, 0x38, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x74, 0x72, 0x75, 0x65, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 0x61, 
-    0x6C, 0x73, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x6E, 0x69, 0x6C, 0x22, 0x2C, 
+    0x20, 0x22, 0x75, 0x69, 0x6E, 0x74, 0x31, 0x36, 0x22, 0x2C, 
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x69, 0x6F, 0x74, 0x61, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x61, 0x70, 0x70, 0x65, 
-    0x6E, 0x64, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x63, 0x61, 0x70, 0x22, 0x2C, 0x0A, 
+    0x75, 0x69, 0x6E, 0x74, 0x33, 0x32, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x75, 0x69, 
+    0x6E, 0x74, 0x36, 0x34, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x75, 0x69, 0x6E, 0x74, 
+    0x70, 0x74, 0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x72, 0x75, 0x65, 0x22, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6E, 0x69, 
+    0x6C, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x69, 0x6F, 0x74, 0x61, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x61, 
+    0x70, 0x70, 0x65, 0x6E, 0x64, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x61, 0x70, 
+    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x22, 0x63, 0x6C, 0x6F, 0x73, 0x65, 0x22, 0x2C, 0x0A, 
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 
-    0x6C, 0x6F, 0x73, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x6F, 0x70, 0x79, 
+    0x6F, 0x70, 0x79, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x64, 0x65, 0x6C, 0x65, 0x74, 
+    0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x6C, 0x65, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6D, 0x61, 
+    0x6B, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x6E, 0x65, 0x77, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x70, 
+    0x61, 0x6E, 0x69, 0x63, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x70, 0x72, 0x69, 0x6E, 
+    0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x6C, 0x6E, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x22, 0x2C, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x6C, 0x65, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x6D, 0x61, 0x6B, 0x65, 0x22, 
-    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x6E, 0x65, 0x77, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x70, 0x61, 0x6E, 0x69, 
-    0x63, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x22, 0x2C, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x70, 0x72, 0x69, 0x6E, 0x74, 0x6C, 0x6E, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x72, 
-    0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x22, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x5D, 0x0A, 0x7D, 0x0A, 0x00, 
+    0x20, 0x22, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x22, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 0x0A, 0x7D, 0x0A, 0x00, 
 };
 
-const char bundle3[] = {
+const char bundle4[] = {
     0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6E, 0x61, 0x6D, 
     0x65, 0x22, 0x3A, 0x20, 0x22, 0x48, 0x54, 0x4D, 0x4C, 0x22, 
     0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x78, 0x74, 
@@ -540,136 +684,159 @@ const char bundle3[] = {
     0x3C, 0x21, 0x2D, 0x2D, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
     0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x2D, 0x2D, 0x3E, 0x22, 
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 
-    0x73, 0x31, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x44, 0x4F, 0x43, 0x54, 
-    0x59, 0x50, 0x45, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x68, 0x74, 0x6D, 0x6C, 0x22, 
-    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x68, 0x65, 0x61, 0x64, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x62, 0x6F, 0x64, 
-    0x79, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x22, 0x2C, 
+    0x20, 0x20, 0x22, 0x65, 0x6D, 0x62, 0x65, 0x64, 0x73, 0x22, 
+    0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x7B, 0x20, 0x22, 0x73, 0x74, 0x61, 0x72, 0x74, 
+    0x22, 0x3A, 0x20, 0x22, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 
+    0x74, 0x22, 0x2C, 0x20, 0x22, 0x6F, 0x70, 0x65, 0x6E, 0x22, 
+    0x3A, 0x20, 0x22, 0x3E, 0x22, 0x2C, 0x20, 0x22, 0x65, 0x6E, 
+    0x64, 0x22, 0x3A, 0x20, 0x22, 0x3C, 0x2F, 0x73, 0x63, 0x72, 
+    0x69, 0x70, 0x74, 0x22, 0x2C, 0x20, 0x22, 0x73, 0x79, 0x6E, 
+    0x74, 0x61, 0x78, 0x22, 0x3A, 0x20, 0x22, 0x4A, 0x61, 0x76, 
+    0x61, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x2C, 0x20, 
+    0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x3A, 0x20, 0x22, 0x6B, 
+    0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x31, 0x22, 0x20, 0x7D, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x7B, 0x20, 0x22, 0x73, 0x74, 0x61, 0x72, 0x74, 0x22, 0x3A, 
+    0x20, 0x22, 0x3C, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x22, 0x2C, 
+    0x20, 0x22, 0x6F, 0x70, 0x65, 0x6E, 0x22, 0x3A, 0x20, 0x22, 
+    0x3E, 0x22, 0x2C, 0x20, 0x22, 0x65, 0x6E, 0x64, 0x22, 0x3A, 
+    0x20, 0x22, 0x3C, 0x2F, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x22, 
+    0x2C, 0x20, 0x22, 0x73, 0x79, 0x6E, 0x74, 0x61, 0x78, 0x22, 
+    0x3A, 0x20, 0x22, 0x43, 0x53, 0x53, 0x22, 0x2C, 0x20, 0x22, 
+    0x74, 0x79, 0x70, 0x65, 0x22, 0x3A, 0x20, 0x22, 0x6B, 0x65, 
+    0x79, 0x77, 0x6F, 0x72, 0x64, 0x31, 0x22, 0x20, 0x7D, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x22, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x73, 
+    0x31, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x44, 0x4F, 0x43, 0x54, 0x59, 
+    0x50, 0x45, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x68, 0x74, 0x6D, 0x6C, 0x22, 0x2C, 
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x6D, 0x65, 0x74, 0x61, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6C, 0x69, 0x6E, 0x6B, 
+    0x68, 0x65, 0x61, 0x64, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x62, 0x6F, 0x64, 0x79, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x2C, 
+    0x20, 0x22, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6D, 
+    0x65, 0x74, 0x61, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x6C, 0x69, 0x6E, 0x6B, 0x22, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 
+    0x74, 0x79, 0x6C, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x64, 0x69, 0x76, 0x22, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x73, 0x70, 0x61, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x70, 0x22, 0x2C, 
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x73, 0x74, 0x79, 0x6C, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x64, 0x69, 0x76, 
+    0x61, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x69, 0x6D, 0x67, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x75, 0x6C, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x73, 0x70, 0x61, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x70, 0x22, 
-    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x61, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x69, 0x6D, 0x67, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x75, 
-    0x6C, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x6F, 0x6C, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6C, 0x69, 0x22, 
+    0x20, 0x22, 0x6F, 0x6C, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6C, 0x69, 0x22, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x72, 0x22, 
     0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x72, 
+    0x22, 0x74, 0x64, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x68, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 
+    0x6F, 0x72, 0x6D, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x6E, 0x70, 0x75, 0x74, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x74, 0x64, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x68, 0x22, 0x2C, 
+    0x20, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x22, 0x2C, 
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x66, 0x6F, 0x72, 0x6D, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x6E, 0x70, 0x75, 
-    0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x22, 
+    0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6F, 0x70, 
+    0x74, 0x69, 0x6F, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x65, 0x78, 0x74, 
+    0x61, 0x72, 0x65, 0x61, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6B, 0x65, 
+    0x79, 0x77, 0x6F, 0x72, 0x64, 0x73, 0x32, 0x22, 0x3A, 0x20, 
+    0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x68, 0x31, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x68, 0x32, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x68, 
+    0x33, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x68, 0x34, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x68, 0x35, 0x22, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x68, 0x36, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x68, 0x65, 0x61, 0x64, 0x65, 
+    0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x66, 0x6F, 0x6F, 0x74, 0x65, 0x72, 0x22, 
     0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6F, 
+    0x22, 0x6E, 0x61, 0x76, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x65, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x61, 0x72, 0x74, 0x69, 0x63, 
+    0x6C, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x61, 0x73, 0x69, 0x64, 0x65, 0x22, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x6D, 0x61, 0x69, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 0x69, 0x67, 
+    0x75, 0x72, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 0x69, 0x67, 0x63, 0x61, 
     0x70, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x65, 0x78, 
-    0x74, 0x61, 0x72, 0x65, 0x61, 0x22, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6B, 
-    0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x73, 0x32, 0x22, 0x3A, 
-    0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x68, 0x31, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x68, 0x32, 0x22, 0x2C, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x68, 0x33, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x68, 0x34, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x68, 0x35, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x66, 0x72, 
+    0x61, 0x6D, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x61, 0x6E, 0x76, 0x61, 
+    0x73, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x73, 0x76, 0x67, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x76, 0x69, 
+    0x64, 0x65, 0x6F, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x61, 0x75, 0x64, 0x69, 0x6F, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x68, 0x36, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x68, 0x65, 0x61, 0x64, 
-    0x65, 0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x66, 0x6F, 0x6F, 0x74, 0x65, 0x72, 
+    0x20, 0x22, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x22, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x22, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x73, 
+    0x33, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x6C, 0x61, 0x73, 0x73, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x6E, 0x61, 0x76, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x65, 0x63, 
-    0x74, 0x69, 0x6F, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x61, 0x72, 0x74, 0x69, 
-    0x63, 0x6C, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x61, 0x73, 0x69, 0x64, 0x65, 
+    0x20, 0x22, 0x69, 0x64, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x68, 0x72, 0x65, 0x66, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x6D, 0x61, 0x69, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 0x69, 
-    0x67, 0x75, 0x72, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 0x69, 0x67, 0x63, 
-    0x61, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x66, 
-    0x72, 0x61, 0x6D, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x61, 0x6E, 0x76, 
-    0x61, 0x73, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x73, 0x76, 0x67, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x76, 
-    0x69, 0x64, 0x65, 0x6F, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x61, 0x75, 0x64, 0x69, 
-    0x6F, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x22, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 
-    0x73, 0x33, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x6C, 0x61, 0x73, 
-    0x73, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x69, 0x64, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x68, 0x72, 0x65, 
-    0x66, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x73, 0x72, 0x63, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x61, 0x6C, 
-    0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x22, 0x2C, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x73, 0x74, 0x79, 0x6C, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 
-    0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x22, 0x2C, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x6E, 0x61, 0x6D, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x70, 0x6C, 0x61, 0x63, 
-    0x65, 0x68, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x72, 
-    0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x64, 
-    0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 
-    0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x65, 
-    0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x72, 0x65, 
-    0x61, 0x64, 0x6F, 0x6E, 0x6C, 0x79, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6D, 0x61, 
-    0x78, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x77, 
-    0x69, 0x64, 0x74, 0x68, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x68, 0x65, 0x69, 0x67, 
-    0x68, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 
+    0x20, 0x22, 0x73, 0x72, 0x63, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x61, 0x6C, 0x74, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x72, 0x65, 0x6C, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x68, 0x61, 
-    0x72, 0x73, 0x65, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x6F, 0x6E, 0x74, 
-    0x65, 0x6E, 0x74, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 
-    0x0A, 0x7D, 0x0A, 0x00, 
+    0x20, 0x22, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 
+    0x74, 0x79, 0x6C, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 
+    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x22, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6E, 
+    0x61, 0x6D, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x70, 0x6C, 0x61, 0x63, 0x65, 
+    0x68, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x72, 0x65, 
+    0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x64, 0x69, 
+    0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x68, 
+    0x65, 0x63, 0x6B, 0x65, 0x64, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x65, 0x6C, 
+    0x65, 0x63, 0x74, 0x65, 0x64, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x72, 0x65, 0x61, 
+    0x64, 0x6F, 0x6E, 0x6C, 0x79, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6D, 0x61, 0x78, 
+    0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x77, 0x69, 
+    0x64, 0x74, 0x68, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x68, 0x65, 0x69, 0x67, 0x68, 
+    0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x22, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x72, 0x65, 0x6C, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x68, 0x61, 0x72, 
+    0x73, 0x65, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x6F, 0x6E, 0x74, 0x65, 
+    0x6E, 0x74, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 0x0A, 
+    0x7D, 0x0A, 0x00, 
 };
 
-const char bundle4[] = {
+const char bundle5[] = {
     0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6E, 0x61, 0x6D, 
     0x65, 0x22, 0x3A, 0x20, 0x22, 0x4A, 0x61, 0x76, 0x61, 0x22, 
     0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x78, 0x74, 
@@ -790,7 +957,7 @@ const char bundle4[] = {
     0x20, 0x20, 0x5D, 0x0A, 0x7D, 0x0A, 0x00, 
 };
 
-const char bundle5[] = {
+const char bundle6[] = {
     0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6E, 0x61, 0x6D, 
     0x65, 0x22, 0x3A, 0x20, 0x22, 0x4A, 0x61, 0x76, 0x61, 0x53, 
     0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
@@ -809,131 +976,146 @@ const char bundle5[] = {
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x2F, 0x2A, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
     0x20, 0x22, 0x2A, 0x2F, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6B, 0x65, 
-    0x79, 0x77, 0x6F, 0x72, 0x64, 0x73, 0x31, 0x22, 0x3A, 0x20, 
-    0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x61, 
-    0x73, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x63, 0x61, 0x74, 0x63, 0x68, 0x22, 
-    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x22, 
-    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x64, 0x65, 0x62, 0x75, 0x67, 0x67, 0x65, 0x72, 0x22, 
-    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x22, 0x2C, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x64, 0x6F, 
-    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x65, 0x6C, 0x73, 0x65, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 0x69, 
-    0x6E, 0x61, 0x6C, 0x6C, 0x79, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 0x6F, 0x72, 
-    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x69, 0x66, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x6E, 0x22, 0x2C, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x69, 0x6E, 0x73, 0x74, 0x61, 0x6E, 0x63, 0x65, 0x6F, 0x66, 
-    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x22, 0x2C, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x68, 
-    0x72, 0x6F, 0x77, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x72, 0x79, 0x22, 0x2C, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x77, 0x68, 0x69, 0x6C, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x77, 0x69, 0x74, 
-    0x68, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x61, 0x77, 0x61, 0x69, 0x74, 0x22, 0x2C, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x79, 0x69, 0x65, 0x6C, 0x64, 0x22, 0x0A, 0x20, 0x20, 0x20, 
+    0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x72, 0x65, 
+    0x67, 0x69, 0x6F, 0x6E, 0x73, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x73, 0x74, 0x61, 0x72, 0x74, 0x22, 0x3A, 
+    0x20, 0x22, 0x60, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 
+    0x6E, 0x64, 0x22, 0x3A, 0x20, 0x22, 0x60, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x65, 0x73, 0x63, 0x61, 0x70, 0x65, 0x22, 
+    0x3A, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x3A, 0x20, 0x22, 0x73, 
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 
     0x20, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6B, 
-    0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x73, 0x32, 0x22, 0x3A, 
+    0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x73, 0x31, 0x22, 0x3A, 
     0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x22, 0x2C, 0x0A, 
+    0x20, 0x22, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x22, 0x2C, 0x0A, 
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 
-    0x6F, 0x6E, 0x73, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x6E, 0x75, 0x6D, 
+    0x61, 0x73, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x61, 0x74, 0x63, 0x68, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x22, 0x2C, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x65, 0x78, 0x74, 0x65, 0x6E, 0x64, 0x73, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 
-    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 
-    0x6D, 0x70, 0x6F, 0x72, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6C, 0x65, 0x74, 
+    0x20, 0x22, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x6E, 0x65, 0x77, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x74, 0x61, 
-    0x74, 0x69, 0x63, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x75, 0x70, 0x65, 0x72, 
+    0x20, 0x22, 0x64, 0x65, 0x62, 0x75, 0x67, 0x67, 0x65, 0x72, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x74, 0x68, 0x69, 0x73, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x79, 
-    0x70, 0x65, 0x6F, 0x66, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x76, 0x61, 0x72, 0x22, 
+    0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x22, 
     0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x76, 0x6F, 0x69, 0x64, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x61, 0x73, 0x79, 
-    0x6E, 0x63, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x66, 0x72, 0x6F, 0x6D, 0x22, 0x2C, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x61, 0x73, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x6F, 0x66, 0x22, 0x0A, 0x20, 0x20, 
+    0x22, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x64, 
+    0x6F, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x65, 0x6C, 0x73, 0x65, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 
+    0x69, 0x6E, 0x61, 0x6C, 0x6C, 0x79, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 0x6F, 
+    0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x69, 0x66, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x6E, 0x22, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6E, 0x63, 0x65, 0x6F, 
+    0x66, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x22, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 
+    0x68, 0x72, 0x6F, 0x77, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x72, 0x79, 0x22, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x77, 0x69, 
+    0x74, 0x68, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x61, 0x77, 0x61, 0x69, 0x74, 0x22, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x22, 0x0A, 0x20, 0x20, 
     0x20, 0x20, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x73, 0x33, 0x22, 
+    0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x73, 0x32, 0x22, 
     0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x74, 0x72, 0x75, 0x65, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 
-    0x61, 0x6C, 0x73, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6E, 0x75, 0x6C, 0x6C, 
-    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x75, 0x6E, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 
-    0x64, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x4E, 0x61, 0x4E, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x49, 0x6E, 
-    0x66, 0x69, 0x6E, 0x69, 0x74, 0x79, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x6F, 
-    0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x77, 0x69, 0x6E, 
-    0x64, 0x6F, 0x77, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x64, 0x6F, 0x63, 0x75, 0x6D, 
-    0x65, 0x6E, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x41, 0x72, 0x72, 0x61, 0x79, 
-    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x22, 0x2C, 
+    0x20, 0x20, 0x22, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x22, 0x2C, 
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x4E, 0x75, 
-    0x6D, 0x62, 0x65, 0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x42, 0x6F, 0x6F, 0x6C, 
-    0x65, 0x61, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x44, 0x61, 0x74, 0x65, 0x22, 
+    0x63, 0x6F, 0x6E, 0x73, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x6E, 0x75, 
+    0x6D, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x22, 
     0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x4D, 0x61, 0x74, 0x68, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x4A, 0x53, 0x4F, 
-    0x4E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x50, 0x72, 0x6F, 0x6D, 0x69, 0x73, 0x65, 
-    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x53, 0x65, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x4D, 0x61, 0x70, 
+    0x22, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x64, 0x73, 0x22, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
+    0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6C, 0x65, 
+    0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x6E, 0x65, 0x77, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x74, 
+    0x61, 0x74, 0x69, 0x63, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x75, 0x70, 0x65, 
+    0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x74, 0x68, 0x69, 0x73, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 
+    0x79, 0x70, 0x65, 0x6F, 0x66, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x76, 0x61, 0x72, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x57, 0x65, 0x61, 0x6B, 0x4D, 0x61, 0x70, 0x22, 
+    0x20, 0x22, 0x76, 0x6F, 0x69, 0x64, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x61, 0x73, 
+    0x79, 0x6E, 0x63, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 0x72, 0x6F, 0x6D, 0x22, 
     0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x57, 0x65, 0x61, 0x6B, 0x53, 0x65, 0x74, 0x22, 0x2C, 
+    0x22, 0x61, 0x73, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x6F, 0x66, 0x22, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x73, 0x33, 
+    0x22, 0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x74, 0x72, 0x75, 0x65, 0x22, 0x2C, 
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x53, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x50, 0x72, 
-    0x6F, 0x78, 0x79, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x52, 0x65, 0x66, 0x6C, 0x65, 
-    0x63, 0x74, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 0x0A, 
-    0x7D, 0x0A, 0x00, 
+    0x66, 0x61, 0x6C, 0x73, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6E, 0x75, 0x6C, 
+    0x6C, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x75, 0x6E, 0x64, 0x65, 0x66, 0x69, 0x6E, 
+    0x65, 0x64, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x4E, 0x61, 0x4E, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x49, 
+    0x6E, 0x66, 0x69, 0x6E, 0x69, 0x74, 0x79, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 
+    0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x77, 0x69, 
+    0x6E, 0x64, 0x6F, 0x77, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x64, 0x6F, 0x63, 0x75, 
+    0x6D, 0x65, 0x6E, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x41, 0x72, 0x72, 0x61, 
+    0x79, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x22, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x4E, 
+    0x75, 0x6D, 0x62, 0x65, 0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x42, 0x6F, 0x6F, 
+    0x6C, 0x65, 0x61, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x44, 0x61, 0x74, 0x65, 
+    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x22, 0x4D, 0x61, 0x74, 0x68, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x4A, 0x53, 
+    0x4F, 0x4E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x50, 0x72, 0x6F, 0x6D, 0x69, 0x73, 
+    0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x53, 0x65, 0x74, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x4D, 0x61, 
+    0x70, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x57, 0x65, 0x61, 0x6B, 0x4D, 0x61, 0x70, 
+    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x22, 0x57, 0x65, 0x61, 0x6B, 0x53, 0x65, 0x74, 0x22, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x53, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x50, 
+    0x72, 0x6F, 0x78, 0x79, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x52, 0x65, 0x66, 0x6C, 
+    0x65, 0x63, 0x74, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 
+    0x0A, 0x7D, 0x0A, 0x00, 
 };
 
-const char bundle6[] = {
+const char bundle7[] = {
     0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6E, 0x61, 0x6D, 
     0x65, 0x22, 0x3A, 0x20, 0x22, 0x4A, 0x53, 0x4F, 0x4E, 0x22, 
     0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x78, 0x74, 
@@ -951,7 +1133,7 @@ const char bundle6[] = {
     0x00, 
 };
 
-const char bundle7[] = {
+const char bundle8[] = {
     0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6E, 0x61, 0x6D, 
     0x65, 0x22, 0x3A, 0x20, 0x22, 0x4D, 0x61, 0x6B, 0x65, 0x66, 
     0x69, 0x6C, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
@@ -1068,7 +1250,7 @@ const char bundle7[] = {
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 0x0A, 0x7D, 0x00, 
 };
 
-const char bundle8[] = {
+const char bundle9[] = {
     0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6E, 0x61, 0x6D, 
     0x65, 0x22, 0x3A, 0x20, 0x22, 0x50, 0x48, 0x50, 0x22, 0x2C, 
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x78, 0x74, 0x65, 
@@ -1085,6 +1267,19 @@ const char bundle8[] = {
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x2F, 0x2A, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
     0x20, 0x22, 0x2A, 0x2F, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x72, 0x65, 
+    0x67, 0x69, 0x6F, 0x6E, 0x73, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x73, 0x74, 0x61, 0x72, 0x74, 0x22, 0x3A, 
+    0x20, 0x22, 0x3C, 0x3C, 0x3C, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x68, 0x65, 0x72, 0x65, 0x64, 0x6F, 0x63, 0x22, 0x3A, 
+    0x20, 0x74, 0x72, 0x75, 0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
+    0x74, 0x79, 0x70, 0x65, 0x22, 0x3A, 0x20, 0x22, 0x73, 0x74, 
+    0x72, 0x69, 0x6E, 0x67, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 
     0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6B, 0x65, 
     0x79, 0x77, 0x6F, 0x72, 0x64, 0x73, 0x31, 0x22, 0x3A, 0x20, 
     0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
@@ -1241,7 +1436,7 @@ const char bundle8[] = {
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 0x0A, 0x7D, 0x0A, 0x00, 
 };
 
-const char bundle9[] = {
+const char bundle10[] = {
     0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6E, 0x61, 0x6D, 
     0x65, 0x22, 0x3A, 0x20, 0x22, 0x50, 0x79, 0x74, 0x68, 0x6F, 
     0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 
@@ -1251,11 +1446,34 @@ const char bundle9[] = {
     0x20, 0x20, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 
     0x63, 0x6F, 0x6D, 0x6D, 0x65, 0x6E, 0x74, 0x22, 0x3A, 0x20, 
     0x22, 0x23, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x6D, 0x75, 0x6C, 0x74, 0x69, 0x6C, 0x69, 0x6E, 0x65, 0x2D, 
-    0x63, 0x6F, 0x6D, 0x6D, 0x65, 0x6E, 0x74, 0x22, 0x3A, 0x20, 
+    0x72, 0x65, 0x67, 0x69, 0x6F, 0x6E, 0x73, 0x22, 0x3A, 0x20, 
     0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x27, 0x27, 0x27, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x27, 0x27, 0x27, 0x22, 
+    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x74, 0x61, 0x72, 0x74, 
+    0x22, 0x3A, 0x20, 0x22, 0x5C, 0x22, 0x5C, 0x22, 0x5C, 0x22, 
+    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x6E, 0x64, 0x22, 
+    0x3A, 0x20, 0x22, 0x5C, 0x22, 0x5C, 0x22, 0x5C, 0x22, 0x22, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x73, 0x63, 0x61, 0x70, 
+    0x65, 0x22, 0x3A, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x3A, 0x20, 
+    0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x73, 0x74, 0x61, 0x72, 0x74, 0x22, 0x3A, 
+    0x20, 0x22, 0x27, 0x27, 0x27, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x65, 0x6E, 0x64, 0x22, 0x3A, 0x20, 0x22, 0x27, 0x27, 
+    0x27, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x73, 0x63, 
+    0x61, 0x70, 0x65, 0x22, 0x3A, 0x20, 0x74, 0x72, 0x75, 0x65, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 
+    0x3A, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 
     0x20, 0x20, 0x22, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 
     0x73, 0x31, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 
@@ -1548,7 +1766,7 @@ const char bundle9[] = {
     0x7D, 0x0A, 0x00, 
 };
 
-const char bundle10[] = {
+const char bundle11[] = {
     0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6E, 0x61, 0x6D, 
     0x65, 0x22, 0x3A, 0x20, 0x22, 0x52, 0x75, 0x62, 0x79, 0x22, 
     0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x78, 0x74, 
@@ -1561,129 +1779,149 @@ const char bundle10[] = {
     0x63, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 0x2C, 0x0A, 
     0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x6F, 0x6D, 0x6D, 0x65, 
     0x6E, 0x74, 0x22, 0x3A, 0x20, 0x22, 0x23, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x6D, 0x75, 0x6C, 0x74, 0x69, 
-    0x6C, 0x69, 0x6E, 0x65, 0x2D, 0x63, 0x6F, 0x6D, 0x6D, 0x65, 
-    0x6E, 0x74, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x3D, 0x62, 0x65, 0x67, 
-    0x69, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x3D, 0x65, 0x6E, 0x64, 0x22, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x73, 
-    0x31, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x62, 0x65, 0x67, 0x69, 0x6E, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x72, 0x65, 0x67, 0x69, 0x6F, 
+    0x6E, 0x73, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
+    0x73, 0x74, 0x61, 0x72, 0x74, 0x22, 0x3A, 0x20, 0x22, 0x3D, 
+    0x62, 0x65, 0x67, 0x69, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x65, 0x6E, 0x64, 0x22, 0x3A, 0x20, 0x22, 0x3D, 0x65, 
+    0x6E, 0x64, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6C, 0x69, 
+    0x6E, 0x65, 0x2D, 0x73, 0x74, 0x61, 0x72, 0x74, 0x22, 0x3A, 
+    0x20, 0x74, 0x72, 0x75, 0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
+    0x74, 0x79, 0x70, 0x65, 0x22, 0x3A, 0x20, 0x22, 0x63, 0x6F, 
+    0x6D, 0x6D, 0x65, 0x6E, 0x74, 0x22, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x73, 0x74, 0x61, 0x72, 0x74, 0x22, 0x3A, 0x20, 0x22, 
+    0x3C, 0x3C, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x68, 0x65, 
+    0x72, 0x65, 0x64, 0x6F, 0x63, 0x22, 0x3A, 0x20, 0x74, 0x72, 
+    0x75, 0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 
+    0x65, 0x22, 0x3A, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 
+    0x67, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x6B, 0x65, 0x79, 0x77, 0x6F, 
+    0x72, 0x64, 0x73, 0x31, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x62, 0x65, 
+    0x67, 0x69, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x62, 0x72, 0x65, 0x61, 0x6B, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 
-    0x61, 0x73, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x64, 0x6F, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 
-    0x6C, 0x73, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x6C, 0x73, 0x69, 0x66, 
+    0x20, 0x22, 0x63, 0x61, 0x73, 0x65, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x64, 0x6F, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x65, 0x6E, 0x64, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x6E, 0x73, 
-    0x75, 0x72, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 0x6F, 0x72, 0x22, 0x2C, 
+    0x20, 0x22, 0x65, 0x6C, 0x73, 0x65, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x6C, 
+    0x73, 0x69, 0x66, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x6E, 0x64, 0x22, 0x2C, 
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x69, 0x66, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x69, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6E, 0x65, 
-    0x78, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x72, 0x61, 0x69, 0x73, 0x65, 0x22, 
+    0x65, 0x6E, 0x73, 0x75, 0x72, 0x65, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 0x6F, 
+    0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x69, 0x66, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x6E, 0x22, 
     0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x72, 0x65, 0x64, 0x6F, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x72, 0x65, 0x73, 
-    0x63, 0x75, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x72, 0x65, 0x74, 0x72, 0x79, 
-    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x22, 0x2C, 
+    0x22, 0x6E, 0x65, 0x78, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x72, 0x61, 0x69, 
+    0x73, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x72, 0x65, 0x64, 0x6F, 0x22, 0x2C, 
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x74, 0x68, 0x65, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x75, 0x6E, 0x6C, 0x65, 
-    0x73, 0x73, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x75, 0x6E, 0x74, 0x69, 0x6C, 0x22, 
+    0x72, 0x65, 0x73, 0x63, 0x75, 0x65, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x72, 0x65, 
+    0x74, 0x72, 0x79, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x72, 0x65, 0x74, 0x75, 0x72, 
+    0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x74, 0x68, 0x65, 0x6E, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x75, 
+    0x6E, 0x6C, 0x65, 0x73, 0x73, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x75, 0x6E, 0x74, 
+    0x69, 0x6C, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x77, 0x68, 0x65, 0x6E, 0x22, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
+    0x77, 0x68, 0x69, 0x6C, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x79, 0x69, 0x65, 
+    0x6C, 0x64, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6B, 0x65, 0x79, 0x77, 
+    0x6F, 0x72, 0x64, 0x73, 0x32, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x61, 
+    0x6C, 0x69, 0x61, 0x73, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x61, 0x6E, 0x64, 0x22, 
     0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x77, 0x68, 0x65, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x77, 0x68, 0x69, 
-    0x6C, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x22, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 
-    0x73, 0x32, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x61, 0x6C, 0x69, 0x61, 
-    0x73, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x61, 0x6E, 0x64, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x6C, 
-    0x61, 0x73, 0x73, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x64, 0x65, 0x66, 0x22, 0x2C, 
+    0x22, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x64, 0x65, 
+    0x66, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x64, 
+    0x3F, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x22, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x6E, 0x6F, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6F, 0x72, 0x22, 0x2C, 
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x64, 0x3F, 0x22, 0x2C, 
+    0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x70, 
+    0x72, 0x6F, 0x74, 0x65, 0x63, 0x74, 0x65, 0x64, 0x22, 0x2C, 
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6E, 0x6F, 
-    0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x6F, 0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x70, 0x72, 0x69, 
-    0x76, 0x61, 0x74, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x70, 0x72, 0x6F, 0x74, 
-    0x65, 0x63, 0x74, 0x65, 0x64, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x70, 0x75, 0x62, 
-    0x6C, 0x69, 0x63, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x72, 0x65, 0x71, 0x75, 0x69, 
-    0x72, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 
-    0x65, 0x5F, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76, 0x65, 
+    0x70, 0x75, 0x62, 0x6C, 0x69, 0x63, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x72, 0x65, 
+    0x71, 0x75, 0x69, 0x72, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x72, 0x65, 0x71, 
+    0x75, 0x69, 0x72, 0x65, 0x5F, 0x72, 0x65, 0x6C, 0x61, 0x74, 
+    0x69, 0x76, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x75, 0x70, 0x65, 0x72, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x73, 0x75, 0x70, 0x65, 0x72, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x75, 
-    0x6E, 0x64, 0x65, 0x66, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x5F, 0x5F, 0x45, 0x4E, 
-    0x43, 0x4F, 0x44, 0x49, 0x4E, 0x47, 0x5F, 0x5F, 0x22, 0x2C, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x5F, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x5F, 0x5F, 0x22, 0x2C, 
+    0x20, 0x22, 0x75, 0x6E, 0x64, 0x65, 0x66, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x5F, 
+    0x5F, 0x45, 0x4E, 0x43, 0x4F, 0x44, 0x49, 0x4E, 0x47, 0x5F, 
+    0x5F, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x5F, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x5F, 
+    0x5F, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x5F, 0x5F, 0x4C, 0x49, 0x4E, 0x45, 0x5F, 
+    0x5F, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x6B, 0x65, 0x79, 0x77, 0x6F, 
+    0x72, 0x64, 0x73, 0x33, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x65, 
+    0x6C, 0x66, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x74, 0x72, 0x75, 0x65, 0x22, 0x2C, 
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x5F, 0x5F, 0x4C, 0x49, 0x4E, 0x45, 0x5F, 0x5F, 0x22, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x73, 
-    0x33, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x65, 0x6C, 0x66, 0x22, 
-    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x74, 0x72, 0x75, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 0x61, 0x6C, 
-    0x73, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x6E, 0x69, 0x6C, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x41, 
-    0x72, 0x72, 0x61, 0x79, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x48, 0x61, 0x73, 0x68, 
+    0x66, 0x61, 0x6C, 0x73, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6E, 0x69, 0x6C, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x2C, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x49, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x46, 
-    0x6C, 0x6F, 0x61, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x53, 0x79, 0x6D, 0x62, 
-    0x6F, 0x6C, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x52, 0x61, 0x6E, 0x67, 0x65, 0x22, 
-    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x52, 0x65, 0x67, 0x65, 0x78, 0x70, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x50, 
-    0x72, 0x6F, 0x63, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x4C, 0x61, 0x6D, 0x62, 0x64, 
-    0x61, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x22, 0x2C, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x4D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x4F, 0x62, 
-    0x6A, 0x65, 0x63, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x4B, 0x65, 0x72, 0x6E, 
-    0x65, 0x6C, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x42, 0x45, 0x47, 0x49, 0x4E, 0x22, 
+    0x20, 0x22, 0x41, 0x72, 0x72, 0x61, 0x79, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x48, 
+    0x61, 0x73, 0x68, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x53, 0x74, 0x72, 0x69, 0x6E, 
+    0x67, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x49, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 
+    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x22, 0x46, 0x6C, 0x6F, 0x61, 0x74, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x53, 
+    0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x52, 0x61, 0x6E, 
+    0x67, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x52, 0x65, 0x67, 0x65, 0x78, 0x70, 
+    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x22, 0x50, 0x72, 0x6F, 0x63, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x4C, 0x61, 
+    0x6D, 0x62, 0x64, 0x61, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x43, 0x6C, 0x61, 0x73, 
+    0x73, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x4D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x22, 
     0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x45, 0x4E, 0x44, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x5D, 0x0A, 0x7D, 0x0A, 0x00, 
+    0x22, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x4B, 
+    0x65, 0x72, 0x6E, 0x65, 0x6C, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x42, 0x45, 0x47, 
+    0x49, 0x4E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x45, 0x4E, 0x44, 0x22, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x5D, 0x0A, 0x7D, 0x0A, 0x00, 
 };
 
-const char bundle11[] = {
+const char bundle12[] = {
     0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6E, 0x61, 0x6D, 
     0x65, 0x22, 0x3A, 0x20, 0x22, 0x52, 0x75, 0x73, 0x74, 0x22, 
     0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x78, 0x74, 
@@ -1692,111 +1930,147 @@ const char bundle11[] = {
     0x22, 0x2E, 0x72, 0x73, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 
     0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x6F, 
     0x6D, 0x6D, 0x65, 0x6E, 0x74, 0x22, 0x3A, 0x20, 0x22, 0x2F, 
-    0x2F, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6D, 
-    0x75, 0x6C, 0x74, 0x69, 0x6C, 0x69, 0x6E, 0x65, 0x2D, 0x63, 
-    0x6F, 0x6D, 0x6D, 0x65, 0x6E, 0x74, 0x22, 0x3A, 0x20, 0x5B, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x2F, 0x2A, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x2A, 0x2F, 0x22, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x73, 0x31, 0x22, 
-    0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x22, 0x2C, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x22, 0x2C, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x65, 0x6C, 0x73, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 0x6F, 0x72, 0x22, 
+    0x2F, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x72, 
+    0x65, 0x67, 0x69, 0x6F, 0x6E, 0x73, 0x22, 0x3A, 0x20, 0x5B, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x73, 0x74, 0x61, 0x72, 0x74, 0x22, 
+    0x3A, 0x20, 0x22, 0x2F, 0x2A, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x65, 0x6E, 0x64, 0x22, 0x3A, 0x20, 0x22, 0x2A, 0x2F, 
+    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6E, 0x65, 0x73, 0x74, 
+    0x65, 0x64, 0x22, 0x3A, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x3A, 
+    0x20, 0x22, 0x63, 0x6F, 0x6D, 0x6D, 0x65, 0x6E, 0x74, 0x22, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 
     0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x69, 0x66, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x6E, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6C, 
-    0x6F, 0x6F, 0x70, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x6D, 0x61, 0x74, 0x63, 0x68, 
+    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x74, 0x61, 0x72, 0x74, 
+    0x22, 0x3A, 0x20, 0x22, 0x72, 0x23, 0x5C, 0x22, 0x22, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x65, 0x6E, 0x64, 0x22, 0x3A, 0x20, 
+    0x22, 0x5C, 0x22, 0x23, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
+    0x66, 0x65, 0x6E, 0x63, 0x65, 0x22, 0x3A, 0x20, 0x22, 0x23, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x22, 0x2C, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x77, 0x68, 0x69, 0x6C, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x61, 0x77, 0x61, 
-    0x69, 0x74, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 0x2C, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 
+    0x22, 0x3A, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 
+    0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x74, 0x61, 0x72, 
+    0x74, 0x22, 0x3A, 0x20, 0x22, 0x62, 0x72, 0x23, 0x5C, 0x22, 
+    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x6E, 0x64, 0x22, 
+    0x3A, 0x20, 0x22, 0x5C, 0x22, 0x23, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x22, 0x66, 0x65, 0x6E, 0x63, 0x65, 0x22, 0x3A, 0x20, 
+    0x22, 0x23, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x79, 
+    0x70, 0x65, 0x22, 0x3A, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 
+    0x6E, 0x67, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 0x2C, 
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6B, 0x65, 0x79, 0x77, 
-    0x6F, 0x72, 0x64, 0x73, 0x32, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x61, 
-    0x73, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x22, 0x2C, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x63, 0x72, 0x61, 0x74, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x6E, 0x75, 
-    0x6D, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x65, 0x78, 0x74, 0x65, 0x72, 0x6E, 0x22, 
-    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 0x6E, 
+    0x6F, 0x72, 0x64, 0x73, 0x31, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x62, 
+    0x72, 0x65, 0x61, 0x6B, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x6F, 0x6E, 0x74, 
+    0x69, 0x6E, 0x75, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x6C, 0x73, 0x65, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x69, 0x6D, 0x70, 0x6C, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6C, 0x65, 
-    0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x6D, 0x6F, 0x64, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6D, 0x6F, 
-    0x76, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x6D, 0x75, 0x74, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x70, 
-    0x75, 0x62, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x72, 0x65, 0x66, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 
-    0x65, 0x6C, 0x66, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x53, 0x65, 0x6C, 0x66, 0x22, 
+    0x20, 0x22, 0x66, 0x6F, 0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x66, 0x22, 
     0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 
-    0x74, 0x72, 0x75, 0x63, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x75, 0x70, 
-    0x65, 0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x74, 0x72, 0x61, 0x69, 0x74, 0x22, 
+    0x22, 0x69, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x6C, 0x6F, 0x6F, 0x70, 0x22, 
     0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x74, 0x72, 0x75, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 
+    0x22, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x77, 0x68, 0x69, 0x6C, 
     0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x75, 0x6E, 0x73, 0x61, 0x66, 0x65, 0x22, 
+    0x20, 0x20, 0x22, 0x61, 0x77, 0x61, 0x69, 0x74, 0x22, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x22, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x73, 
+    0x32, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x61, 0x73, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 
+    0x6F, 0x6E, 0x73, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x72, 0x61, 0x74, 
+    0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x65, 0x6E, 0x75, 0x6D, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 
+    0x78, 0x74, 0x65, 0x72, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 0x61, 0x6C, 
+    0x73, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x66, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x6D, 
+    0x70, 0x6C, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x6C, 0x65, 0x74, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6D, 
+    0x6F, 0x64, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x6D, 0x6F, 0x76, 0x65, 0x22, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
+    0x6D, 0x75, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x70, 0x75, 0x62, 0x22, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
+    0x72, 0x65, 0x66, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x65, 0x6C, 0x66, 0x22, 
     0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x75, 0x73, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x77, 0x68, 0x65, 0x72, 
-    0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x64, 0x79, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x61, 0x73, 
-    0x79, 0x6E, 0x63, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 
-    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6B, 0x65, 0x79, 
-    0x77, 0x6F, 0x72, 0x64, 0x73, 0x33, 0x22, 0x3A, 0x20, 0x5B, 
+    0x22, 0x53, 0x65, 0x6C, 0x66, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x74, 0x61, 
+    0x74, 0x69, 0x63, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x74, 0x72, 0x75, 0x63, 
+    0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x73, 0x75, 0x70, 0x65, 0x72, 0x22, 0x2C, 
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x62, 0x6F, 0x6F, 0x6C, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x68, 0x61, 0x72, 
+    0x74, 0x72, 0x61, 0x69, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x72, 0x75, 
+    0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x75, 
+    0x6E, 0x73, 0x61, 0x66, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x75, 0x73, 0x65, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x73, 0x74, 0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x38, 0x22, 
-    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x69, 0x31, 0x36, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x33, 0x32, 0x22, 
-    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x69, 0x36, 0x34, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x31, 0x32, 0x38, 
+    0x20, 0x22, 0x77, 0x68, 0x65, 0x72, 0x65, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x64, 
+    0x79, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x22, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 
+    0x73, 0x33, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x62, 0x6F, 0x6F, 0x6C, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x75, 0x38, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x75, 0x31, 0x36, 0x22, 
-    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x75, 0x33, 0x32, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x75, 0x36, 0x34, 0x22, 
-    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x75, 0x31, 0x32, 0x38, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x73, 0x69, 
-    0x7A, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x75, 0x73, 0x69, 0x7A, 0x65, 0x22, 
-    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x66, 0x33, 0x32, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 0x36, 0x34, 0x22, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 0x0A, 0x7D, 0x0A, 0x00, 
+    0x20, 0x22, 0x63, 0x68, 0x61, 0x72, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x74, 
+    0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x69, 0x38, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x31, 0x36, 
+    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x22, 0x69, 0x33, 0x32, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x36, 0x34, 
+    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x22, 0x69, 0x31, 0x32, 0x38, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x75, 0x38, 
+    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x22, 0x75, 0x31, 0x36, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x75, 0x33, 0x32, 
+    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x22, 0x75, 0x36, 0x34, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x75, 0x31, 0x32, 
+    0x38, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x69, 0x73, 0x69, 0x7A, 0x65, 0x22, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
+    0x75, 0x73, 0x69, 0x7A, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 0x33, 0x32, 
+    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x22, 0x66, 0x36, 0x34, 0x22, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x5D, 0x0A, 0x7D, 0x0A, 0x00, 
 };
 
-const char bundle12[] = {
+const char bundle13[] = {
     0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6E, 0x61, 0x6D, 
     0x65, 0x22, 0x3A, 0x20, 0x22, 0x53, 0x68, 0x65, 0x6C, 0x6C, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x78, 
@@ -1815,105 +2089,118 @@ const char bundle12[] = {
     0x20, 0x20, 0x22, 0x3A, 0x20, 0x27, 0x22, 0x2C, 0x0A, 0x20, 
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x27, 0x22, 
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 
-    0x73, 0x31, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x62, 0x72, 0x65, 0x61, 
-    0x6B, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x63, 0x61, 0x73, 0x65, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 
-    0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x64, 
-    0x6F, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x64, 0x6F, 0x6E, 0x65, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 
-    0x6C, 0x69, 0x66, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x6C, 0x73, 0x65, 0x22, 
+    0x20, 0x20, 0x22, 0x72, 0x65, 0x67, 0x69, 0x6F, 0x6E, 0x73, 
+    0x22, 0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x74, 
+    0x61, 0x72, 0x74, 0x22, 0x3A, 0x20, 0x22, 0x3C, 0x3C, 0x22, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x68, 0x65, 0x72, 0x65, 0x64, 
+    0x6F, 0x63, 0x22, 0x3A, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x3A, 
+    0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x22, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x73, 
+    0x31, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x62, 0x72, 0x65, 0x61, 0x6B, 
+    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x22, 0x63, 0x61, 0x73, 0x65, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x6F, 
+    0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x64, 0x6F, 
+    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x22, 0x64, 0x6F, 0x6E, 0x65, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x6C, 
+    0x69, 0x66, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x65, 0x6C, 0x73, 0x65, 0x22, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
+    0x65, 0x73, 0x61, 0x63, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 0x69, 0x22, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
+    0x66, 0x6F, 0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x66, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 
+    0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x22, 
     0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x65, 0x73, 0x61, 0x63, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 0x69, 0x22, 
+    0x22, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 
+    0x68, 0x65, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x69, 0x6D, 0x65, 0x22, 
     0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x66, 0x6F, 0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 0x75, 0x6E, 0x63, 
-    0x74, 0x69, 0x6F, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x66, 0x22, 0x2C, 
+    0x22, 0x75, 0x6E, 0x74, 0x69, 0x6C, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x77, 0x68, 
+    0x69, 0x6C, 0x65, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6B, 0x65, 0x79, 
+    0x77, 0x6F, 0x72, 0x64, 0x73, 0x32, 0x22, 0x3A, 0x20, 0x5B, 
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x69, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x61, 0x6C, 0x69, 0x61, 0x73, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x78, 0x70, 
+    0x6F, 0x72, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x22, 0x2C, 
+    0x20, 0x22, 0x72, 0x65, 0x61, 0x64, 0x6F, 0x6E, 0x6C, 0x79, 
+    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x22, 0x64, 0x65, 0x63, 0x6C, 0x61, 0x72, 0x65, 0x22, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x74, 0x79, 0x70, 0x65, 0x73, 0x65, 0x74, 0x22, 0x2C, 
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x74, 0x68, 0x65, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x69, 0x6D, 0x65, 
+    0x75, 0x6E, 0x73, 0x65, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x68, 0x69, 
+    0x66, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x75, 0x6E, 0x74, 0x69, 0x6C, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x77, 
-    0x68, 0x69, 0x6C, 0x65, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6B, 0x65, 
-    0x79, 0x77, 0x6F, 0x72, 0x64, 0x73, 0x32, 0x22, 0x3A, 0x20, 
-    0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x61, 0x6C, 0x69, 0x61, 0x73, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x22, 0x65, 0x76, 0x61, 0x6C, 0x22, 0x2C, 0x0A, 0x20, 
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x78, 
-    0x70, 0x6F, 0x72, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6C, 0x6F, 0x63, 0x61, 
-    0x6C, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x72, 0x65, 0x61, 0x64, 0x6F, 0x6E, 0x6C, 
-    0x79, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x64, 0x65, 0x63, 0x6C, 0x61, 0x72, 0x65, 
-    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x73, 0x65, 0x74, 0x22, 
+    0x65, 0x63, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x65, 0x78, 0x69, 0x74, 0x22, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
+    0x74, 0x72, 0x61, 0x70, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x65, 0x74, 0x22, 
     0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x68, 
-    0x69, 0x66, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x6F, 0x75, 0x72, 0x63, 
-    0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x65, 0x76, 0x61, 0x6C, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 
-    0x78, 0x65, 0x63, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x78, 0x69, 0x74, 0x22, 
+    0x22, 0x75, 0x6E, 0x61, 0x6C, 0x69, 0x61, 0x73, 0x22, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x22, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x73, 
+    0x33, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x72, 0x75, 0x65, 0x22, 
     0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x74, 0x72, 0x61, 0x70, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x65, 0x74, 
-    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x75, 0x6E, 0x61, 0x6C, 0x69, 0x61, 0x73, 0x22, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 
-    0x73, 0x33, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x72, 0x75, 0x65, 
-    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 
-    0x63, 0x68, 0x6F, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x70, 0x72, 0x69, 0x6E, 0x74, 
-    0x66, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x72, 0x65, 0x61, 0x64, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 
-    0x65, 0x73, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x64, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x70, 
-    0x77, 0x64, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x6C, 0x73, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x70, 
-    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x6D, 0x76, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x72, 0x6D, 0x22, 0x2C, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x6D, 0x6B, 0x64, 0x69, 0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x61, 0x74, 
+    0x22, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x63, 
+    0x68, 0x6F, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x67, 0x72, 0x65, 0x70, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x65, 
+    0x20, 0x22, 0x72, 0x65, 0x61, 0x64, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x65, 
+    0x73, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x63, 0x64, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x70, 0x77, 
     0x64, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x61, 0x77, 0x6B, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 0x69, 
-    0x6E, 0x64, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x63, 0x68, 0x6D, 0x6F, 0x64, 0x22, 
+    0x20, 0x20, 0x22, 0x6C, 0x73, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x70, 0x22, 
     0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x63, 0x68, 0x6F, 0x77, 0x6E, 0x22, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x5D, 0x0A, 0x7D, 0x0A, 0x00, 
+    0x22, 0x6D, 0x76, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x72, 0x6D, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6D, 
+    0x6B, 0x64, 0x69, 0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x61, 0x74, 0x22, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x67, 0x72, 0x65, 0x70, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x65, 0x64, 
+    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x22, 0x61, 0x77, 0x6B, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 0x69, 0x6E, 
+    0x64, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x63, 0x68, 0x6D, 0x6F, 0x64, 0x22, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
+    0x63, 0x68, 0x6F, 0x77, 0x6E, 0x22, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x5D, 0x0A, 0x7D, 0x0A, 0x00, 
 };
 
-const char bundle13[] = {
+const char bundle14[] = {
     0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6E, 0x61, 0x6D, 
     0x65, 0x22, 0x3A, 0x20, 0x22, 0x53, 0x51, 0x4C, 0x22, 0x2C, 
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x78, 0x74, 0x65, 
@@ -2076,7 +2363,7 @@ const char bundle13[] = {
     0x20, 0x20, 0x20, 0x5D, 0x0A, 0x7D, 0x0A, 0x00, 
 };
 
-const char bundle14[] = {
+const char bundle15[] = {
     0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6E, 0x61, 0x6D, 
     0x65, 0x22, 0x3A, 0x20, 0x22, 0x54, 0x79, 0x70, 0x65, 0x53, 
     0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
@@ -2094,155 +2381,170 @@ const char bundle14[] = {
     0x20, 0x22, 0x2F, 0x2A, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
     0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x2A, 0x2F, 0x22, 0x0A, 
     0x20, 0x20, 0x20, 0x20, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x73, 
-    0x31, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x62, 0x72, 0x65, 0x61, 0x6B, 
-    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x63, 0x61, 0x73, 0x65, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x61, 
-    0x74, 0x63, 0x68, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x6F, 0x6E, 0x74, 0x69, 
-    0x6E, 0x75, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x64, 0x65, 0x62, 0x75, 0x67, 
-    0x67, 0x65, 0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 
-    0x6C, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 
-    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x64, 0x6F, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x6C, 0x73, 0x65, 
+    0x20, 0x22, 0x72, 0x65, 0x67, 0x69, 0x6F, 0x6E, 0x73, 0x22, 
+    0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x74, 0x61, 
+    0x72, 0x74, 0x22, 0x3A, 0x20, 0x22, 0x60, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x65, 0x6E, 0x64, 0x22, 0x3A, 0x20, 0x22, 
+    0x60, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x73, 0x63, 
+    0x61, 0x70, 0x65, 0x22, 0x3A, 0x20, 0x74, 0x72, 0x75, 0x65, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 
+    0x3A, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 
+    0x73, 0x31, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x62, 0x72, 0x65, 0x61, 
+    0x6B, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x63, 0x61, 0x73, 0x65, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 
+    0x61, 0x74, 0x63, 0x68, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x6F, 0x6E, 0x74, 
+    0x69, 0x6E, 0x75, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x64, 0x65, 0x62, 0x75, 
+    0x67, 0x67, 0x65, 0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 
+    0x75, 0x6C, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x64, 0x65, 0x6C, 0x65, 0x74, 
+    0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x64, 0x6F, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x6C, 0x73, 
+    0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x66, 0x69, 0x6E, 0x61, 0x6C, 0x6C, 0x79, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x66, 0x69, 0x6E, 0x61, 0x6C, 0x6C, 0x79, 0x22, 
+    0x20, 0x22, 0x66, 0x6F, 0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x66, 0x22, 
     0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x66, 0x6F, 0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x66, 0x22, 0x2C, 
+    0x22, 0x69, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x6E, 0x73, 0x74, 0x61, 
+    0x6E, 0x63, 0x65, 0x6F, 0x66, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x77, 0x69, 0x74, 0x63, 
+    0x68, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x74, 0x68, 0x72, 0x6F, 0x77, 0x22, 0x2C, 
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x69, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6E, 
-    0x63, 0x65, 0x6F, 0x66, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x72, 0x65, 0x74, 0x75, 
-    0x72, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 
+    0x74, 0x72, 0x79, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x77, 0x68, 0x69, 0x6C, 0x65, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x74, 0x68, 0x72, 0x6F, 0x77, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 
-    0x72, 0x79, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x22, 
+    0x20, 0x22, 0x77, 0x69, 0x74, 0x68, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x61, 0x77, 
+    0x61, 0x69, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x79, 0x69, 0x65, 0x6C, 0x64, 
+    0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 
+    0x64, 0x73, 0x32, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x61, 0x62, 0x73, 
+    0x74, 0x72, 0x61, 0x63, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x61, 0x73, 0x22, 
     0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x77, 0x69, 0x74, 0x68, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x61, 0x77, 0x61, 
-    0x69, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x22, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 
-    0x73, 0x32, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x61, 0x62, 0x73, 0x74, 
-    0x72, 0x61, 0x63, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x61, 0x73, 0x22, 0x2C, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x61, 0x73, 0x79, 0x6E, 0x63, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x6C, 0x61, 
-    0x73, 0x73, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x22, 
+    0x22, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x6C, 
+    0x61, 0x73, 0x73, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x63, 0x6F, 0x6E, 0x73, 0x74, 
+    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x22, 0x64, 0x65, 0x63, 0x6C, 0x61, 0x72, 0x65, 0x22, 
     0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x64, 0x65, 0x63, 0x6C, 0x61, 0x72, 0x65, 0x22, 0x2C, 
+    0x22, 0x65, 0x6E, 0x75, 0x6D, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x78, 0x70, 
+    0x6F, 0x72, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x78, 0x74, 0x65, 0x6E, 
+    0x64, 0x73, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x66, 0x72, 0x6F, 0x6D, 0x22, 0x2C, 
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x65, 0x6E, 0x75, 0x6D, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x78, 0x70, 0x6F, 
-    0x72, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x64, 
-    0x73, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x66, 0x72, 0x6F, 0x6D, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 
-    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 
-    0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x22, 
-    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 
-    0x6E, 0x74, 0x65, 0x72, 0x66, 0x61, 0x63, 0x65, 0x22, 0x2C, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x2C, 
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x6C, 0x65, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 
-    0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x6E, 0x61, 0x6D, 0x65, 0x73, 0x70, 0x61, 
-    0x63, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x6E, 0x65, 0x77, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6F, 
-    0x66, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 
-    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x22, 
-    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x70, 0x72, 0x6F, 0x74, 0x65, 0x63, 0x74, 0x65, 0x64, 
+    0x69, 0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x70, 0x75, 0x62, 0x6C, 0x69, 0x63, 0x22, 0x2C, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x72, 0x65, 0x61, 0x64, 0x6F, 0x6E, 0x6C, 0x79, 0x22, 0x2C, 
+    0x20, 0x22, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x22, 0x2C, 
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x75, 
-    0x70, 0x65, 0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x68, 0x69, 0x73, 0x22, 
+    0x69, 0x6E, 0x74, 0x65, 0x72, 0x66, 0x61, 0x63, 0x65, 0x22, 
     0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 
-    0x65, 0x6F, 0x66, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x76, 0x61, 0x72, 0x22, 0x2C, 
+    0x22, 0x6C, 0x65, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6D, 0x6F, 0x64, 0x75, 
+    0x6C, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x6E, 0x61, 0x6D, 0x65, 0x73, 0x70, 
+    0x61, 0x63, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x6E, 0x65, 0x77, 0x22, 0x2C, 
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x76, 0x6F, 0x69, 0x64, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6B, 0x65, 
-    0x79, 0x77, 0x6F, 0x72, 0x64, 0x73, 0x33, 0x22, 0x3A, 0x20, 
-    0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x61, 0x6E, 0x79, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x62, 0x6F, 0x6F, 0x6C, 
-    0x65, 0x61, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x6E, 0x65, 0x76, 0x65, 0x72, 
-    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x6E, 0x75, 0x6C, 0x6C, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6E, 0x75, 
-    0x6D, 0x62, 0x65, 0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 
-    0x6E, 0x67, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 
+    0x6F, 0x66, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 
+    0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x75, 0x6E, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 
+    0x20, 0x22, 0x70, 0x72, 0x6F, 0x74, 0x65, 0x63, 0x74, 0x65, 
     0x64, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x75, 0x6E, 0x6B, 0x6E, 0x6F, 0x77, 0x6E, 
+    0x20, 0x20, 0x22, 0x70, 0x75, 0x62, 0x6C, 0x69, 0x63, 0x22, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x72, 0x65, 0x61, 0x64, 0x6F, 0x6E, 0x6C, 0x79, 0x22, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 
+    0x75, 0x70, 0x65, 0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x68, 0x69, 0x73, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x76, 0x6F, 0x69, 0x64, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x72, 
-    0x75, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x22, 
+    0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x79, 
+    0x70, 0x65, 0x6F, 0x66, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x76, 0x61, 0x72, 0x22, 
     0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x41, 0x72, 0x72, 0x61, 0x79, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x4F, 0x62, 
-    0x6A, 0x65, 0x63, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x53, 0x74, 0x72, 0x69, 
-    0x6E, 0x67, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x22, 0x4E, 0x75, 0x6D, 0x62, 0x65, 0x72, 
+    0x22, 0x76, 0x6F, 0x69, 0x64, 0x22, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6B, 
+    0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x73, 0x33, 0x22, 0x3A, 
+    0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x22, 0x61, 0x6E, 0x79, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x62, 0x6F, 0x6F, 
+    0x6C, 0x65, 0x61, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6E, 0x65, 0x76, 0x65, 
+    0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x6E, 0x75, 0x6C, 0x6C, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6E, 
+    0x75, 0x6D, 0x62, 0x65, 0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x74, 0x72, 
+    0x69, 0x6E, 0x67, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x79, 0x6D, 0x62, 0x6F, 
+    0x6C, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x75, 0x6E, 0x64, 0x65, 0x66, 0x69, 0x6E, 
+    0x65, 0x64, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x75, 0x6E, 0x6B, 0x6E, 0x6F, 0x77, 
+    0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x76, 0x6F, 0x69, 0x64, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 
+    0x72, 0x75, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 0x61, 0x6C, 0x73, 0x65, 
+    0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x22, 0x41, 0x72, 0x72, 0x61, 0x79, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x4F, 
+    0x62, 0x6A, 0x65, 0x63, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x53, 0x74, 0x72, 
+    0x69, 0x6E, 0x67, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x4E, 0x75, 0x6D, 0x62, 0x65, 
+    0x72, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x42, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E, 
     0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x42, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x22, 
+    0x20, 0x22, 0x50, 0x72, 0x6F, 0x6D, 0x69, 0x73, 0x65, 0x22, 
     0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x50, 0x72, 0x6F, 0x6D, 0x69, 0x73, 0x65, 0x22, 0x2C, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x53, 0x65, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x4D, 0x61, 0x70, 0x22, 0x2C, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x52, 0x65, 0x63, 0x6F, 0x72, 0x64, 0x22, 0x2C, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x50, 0x61, 
-    0x72, 0x74, 0x69, 0x61, 0x6C, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x52, 0x65, 0x71, 
-    0x75, 0x69, 0x72, 0x65, 0x64, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x52, 0x65, 0x61, 
-    0x64, 0x6F, 0x6E, 0x6C, 0x79, 0x22, 0x2C, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x50, 0x69, 0x63, 
-    0x6B, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x4F, 0x6D, 0x69, 0x74, 0x22, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x5D, 0x0A, 0x7D, 0x0A, 0x00, 
+    0x22, 0x53, 0x65, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x4D, 0x61, 0x70, 0x22, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x52, 0x65, 0x63, 0x6F, 0x72, 0x64, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x50, 
+    0x61, 0x72, 0x74, 0x69, 0x61, 0x6C, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x52, 0x65, 
+    0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x52, 0x65, 
+    0x61, 0x64, 0x6F, 0x6E, 0x6C, 0x79, 0x22, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x50, 0x69, 
+    0x63, 0x6B, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x4F, 0x6D, 0x69, 0x74, 0x22, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x5D, 0x0A, 0x7D, 0x0A, 0x00, 
 };
 
-const char bundle15[] = {
+const char bundle16[] = {
     0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6E, 0x61, 0x6D, 
     0x65, 0x22, 0x3A, 0x20, 0x22, 0x7A, 0x69, 0x67, 0x22, 0x2C, 
     0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x78, 0x74, 0x65, 
@@ -2409,7 +2711,7 @@ const char bundle15[] = {
     0x20, 0x20, 0x20, 0x20, 0x5D, 0x0A, 0x7D, 0x0A, 0x00, 
 };
 
-const char bundle16[] = {
+const char bundle17[] = {
     0x7B, 0x0A, 0x20, 0x20, 0x22, 0x6E, 0x61, 0x6D, 0x65, 0x22, 
     0x3A, 0x20, 0x22, 0x6D, 0x61, 0x72, 0x6B, 0x64, 0x6F, 0x77, 
     0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x22, 0x65, 0x78, 0x74, 
@@ -2418,58 +2720,84 @@ const char bundle16[] = {
     0x6D, 0x61, 0x72, 0x6B, 0x64, 0x6F, 0x77, 0x6E, 0x22, 0x2C, 
     0x20, 0x22, 0x52, 0x45, 0x41, 0x44, 0x4D, 0x45, 0x22, 0x2C, 
     0x20, 0x22, 0x52, 0x45, 0x41, 0x44, 0x4D, 0x45, 0x2E, 0x6D, 
-    0x64, 0x22, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x22, 0x73, 0x69, 
-    0x6E, 0x67, 0x6C, 0x65, 0x6C, 0x69, 0x6E, 0x65, 0x5F, 0x63, 
-    0x6F, 0x6D, 0x6D, 0x65, 0x6E, 0x74, 0x5F, 0x73, 0x74, 0x61, 
-    0x72, 0x74, 0x22, 0x3A, 0x20, 0x22, 0x3E, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x22, 0x6D, 0x75, 0x6C, 0x74, 0x69, 0x6C, 0x69, 
-    0x6E, 0x65, 0x5F, 0x63, 0x6F, 0x6D, 0x6D, 0x65, 0x6E, 0x74, 
-    0x5F, 0x73, 0x74, 0x61, 0x72, 0x74, 0x22, 0x3A, 0x20, 0x22, 
-    0x60, 0x60, 0x60, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x22, 0x6D, 
-    0x75, 0x6C, 0x74, 0x69, 0x6C, 0x69, 0x6E, 0x65, 0x5F, 0x63, 
-    0x6F, 0x6D, 0x6D, 0x65, 0x6E, 0x74, 0x5F, 0x65, 0x6E, 0x64, 
-    0x22, 0x3A, 0x20, 0x22, 0x60, 0x60, 0x60, 0x22, 0x2C, 0x0A, 
-    0x20, 0x20, 0x22, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x22, 0x3A, 
-    0x20, 0x30, 0x2C, 0x0A, 0x20, 0x20, 0x22, 0x6B, 0x65, 0x79, 
-    0x77, 0x6F, 0x72, 0x64, 0x73, 0x31, 0x22, 0x3A, 0x20, 0x5B, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x23, 0x22, 0x2C, 0x20, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x23, 0x23, 0x22, 0x2C, 
-    0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x23, 0x23, 0x23, 
-    0x22, 0x2C, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x23, 
+    0x64, 0x22, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x22, 0x65, 0x6D, 
+    0x62, 0x65, 0x64, 0x73, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x7B, 0x22, 0x73, 0x74, 0x61, 0x72, 0x74, 
+    0x22, 0x3A, 0x20, 0x22, 0x60, 0x60, 0x60, 0x22, 0x2C, 0x20, 
+    0x22, 0x65, 0x6E, 0x64, 0x22, 0x3A, 0x20, 0x22, 0x60, 0x60, 
+    0x60, 0x22, 0x2C, 0x20, 0x22, 0x69, 0x6E, 0x66, 0x6F, 0x22, 
+    0x3A, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2C, 0x20, 0x22, 0x6C, 
+    0x69, 0x6E, 0x65, 0x2D, 0x73, 0x74, 0x61, 0x72, 0x74, 0x22, 
+    0x3A, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2C, 0x20, 0x22, 0x74, 
+    0x79, 0x70, 0x65, 0x22, 0x3A, 0x20, 0x22, 0x73, 0x74, 0x72, 
+    0x69, 0x6E, 0x67, 0x22, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x7B, 0x22, 0x73, 0x74, 0x61, 0x72, 0x74, 0x22, 0x3A, 
+    0x20, 0x22, 0x7E, 0x7E, 0x7E, 0x22, 0x2C, 0x20, 0x22, 0x65, 
+    0x6E, 0x64, 0x22, 0x3A, 0x20, 0x22, 0x7E, 0x7E, 0x7E, 0x22, 
+    0x2C, 0x20, 0x22, 0x69, 0x6E, 0x66, 0x6F, 0x22, 0x3A, 0x20, 
+    0x74, 0x72, 0x75, 0x65, 0x2C, 0x20, 0x22, 0x6C, 0x69, 0x6E, 
+    0x65, 0x2D, 0x73, 0x74, 0x61, 0x72, 0x74, 0x22, 0x3A, 0x20, 
+    0x74, 0x72, 0x75, 0x65, 0x2C, 0x20, 0x22, 0x74, 0x79, 0x70, 
+    0x65, 0x22, 0x3A, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 
+    0x67, 0x22, 0x7D, 0x0A, 0x20, 0x20, 0x5D, 0x2C, 0x0A, 0x20, 
+    0x20, 0x22, 0x72, 0x65, 0x67, 0x69, 0x6F, 0x6E, 0x73, 0x22, 
+    0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x22, 
+    0x73, 0x74, 0x61, 0x72, 0x74, 0x22, 0x3A, 0x20, 0x22, 0x60, 
+    0x60, 0x60, 0x22, 0x2C, 0x20, 0x22, 0x65, 0x6E, 0x64, 0x22, 
+    0x3A, 0x20, 0x22, 0x60, 0x60, 0x60, 0x22, 0x2C, 0x20, 0x22, 
+    0x6C, 0x69, 0x6E, 0x65, 0x2D, 0x73, 0x74, 0x61, 0x72, 0x74, 
+    0x22, 0x3A, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2C, 0x20, 0x22, 
+    0x74, 0x79, 0x70, 0x65, 0x22, 0x3A, 0x20, 0x22, 0x73, 0x74, 
+    0x72, 0x69, 0x6E, 0x67, 0x22, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x7B, 0x22, 0x73, 0x74, 0x61, 0x72, 0x74, 0x22, 
+    0x3A, 0x20, 0x22, 0x7E, 0x7E, 0x7E, 0x22, 0x2C, 0x20, 0x22, 
+    0x65, 0x6E, 0x64, 0x22, 0x3A, 0x20, 0x22, 0x7E, 0x7E, 0x7E, 
+    0x22, 0x2C, 0x20, 0x22, 0x6C, 0x69, 0x6E, 0x65, 0x2D, 0x73, 
+    0x74, 0x61, 0x72, 0x74, 0x22, 0x3A, 0x20, 0x74, 0x72, 0x75, 
+    0x65, 0x2C, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x3A, 
+    0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x7D, 
+    0x0A, 0x20, 0x20, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x22, 0x66, 
+    0x6C, 0x61, 0x67, 0x73, 0x22, 0x3A, 0x20, 0x30, 0x2C, 0x0A, 
+    0x20, 0x20, 0x22, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 
+    0x73, 0x31, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x22, 0x23, 0x22, 0x2C, 0x20, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x22, 0x23, 0x23, 0x22, 0x2C, 0x20, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x23, 0x23, 0x23, 0x22, 0x2C, 0x20, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x23, 0x23, 0x23, 0x23, 0x22, 
+    0x2C, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x23, 0x23, 
     0x23, 0x23, 0x23, 0x22, 0x2C, 0x20, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x23, 0x23, 0x23, 0x23, 0x23, 0x22, 0x2C, 0x20, 
-    0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x23, 0x23, 0x23, 0x23, 
-    0x23, 0x23, 0x22, 0x2C, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 
-    0x22, 0x2A, 0x2A, 0x22, 0x2C, 0x20, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x22, 0x5F, 0x5F, 0x22, 0x2C, 0x20, 0x0A, 0x20, 0x20, 
-    0x20, 0x20, 0x22, 0x2D, 0x2D, 0x2D, 0x22, 0x2C, 0x20, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x3D, 0x3D, 0x3D, 0x22, 0x2C, 
-    0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x5F, 0x5F, 0x5F, 
-    0x22, 0x2C, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x5C, 
-    0x5C, 0x62, 0x28, 0x54, 0x4F, 0x44, 0x4F, 0x7C, 0x46, 0x49, 
-    0x58, 0x4D, 0x45, 0x7C, 0x4E, 0x4F, 0x54, 0x45, 0x7C, 0x49, 
-    0x4D, 0x50, 0x4F, 0x52, 0x54, 0x41, 0x4E, 0x54, 0x7C, 0x57, 
-    0x41, 0x52, 0x4E, 0x49, 0x4E, 0x47, 0x29, 0x3A, 0x22, 0x0A, 
-    0x20, 0x20, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x22, 0x6B, 0x65, 
-    0x79, 0x77, 0x6F, 0x72, 0x64, 0x73, 0x32, 0x22, 0x3A, 0x20, 
-    0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x5B, 0x22, 0x2C, 
-    0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x5D, 0x22, 0x2C, 
-    0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x28, 0x22, 0x2C, 
-    0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x29, 0x22, 0x2C, 
-    0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x2A, 0x22, 0x2C, 
-    0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x5F, 0x22, 0x2C, 
-    0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x21, 0x22, 0x2C, 
-    0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x60, 0x22, 0x0A, 
-    0x20, 0x20, 0x5D, 0x2C, 0x0A, 0x20, 0x20, 0x22, 0x6B, 0x65, 
-    0x79, 0x77, 0x6F, 0x72, 0x64, 0x73, 0x33, 0x22, 0x3A, 0x20, 
-    0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x2D, 0x20, 0x22, 
-    0x2C, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x2B, 0x20, 
-    0x22, 0x2C, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x2A, 
-    0x20, 0x22, 0x2C, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x7C, 0x22, 0x2C, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 
-    0x2A, 0x2A, 0x5C, 0x5C, 0x2A, 0x2A, 0x22, 0x2C, 0x20, 0x0A, 
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x2A, 0x2A, 0x5C, 0x5C, 0x5F, 
-    0x2A, 0x2A, 0x22, 0x0A, 0x20, 0x20, 0x5D, 0x0A, 0x7D, 0x00, 
+    0x20, 0x22, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x22, 0x2C, 
+    0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x2A, 0x2A, 0x22, 
+    0x2C, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x5F, 0x5F, 
+    0x22, 0x2C, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x2D, 
+    0x2D, 0x2D, 0x22, 0x2C, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x3D, 0x3D, 0x3D, 0x22, 0x2C, 0x20, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x5F, 0x5F, 0x5F, 0x22, 0x2C, 0x20, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x5C, 0x5C, 0x62, 0x28, 0x54, 
+    0x4F, 0x44, 0x4F, 0x7C, 0x46, 0x49, 0x58, 0x4D, 0x45, 0x7C, 
+    0x4E, 0x4F, 0x54, 0x45, 0x7C, 0x49, 0x4D, 0x50, 0x4F, 0x52, 
+    0x54, 0x41, 0x4E, 0x54, 0x7C, 0x57, 0x41, 0x52, 0x4E, 0x49, 
+    0x4E, 0x47, 0x29, 0x3A, 0x22, 0x0A, 0x20, 0x20, 0x5D, 0x2C, 
+    0x0A, 0x20, 0x20, 0x22, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 
+    0x64, 0x73, 0x32, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x5B, 0x22, 0x2C, 0x20, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x5D, 0x22, 0x2C, 0x20, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x28, 0x22, 0x2C, 0x20, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x29, 0x22, 0x2C, 0x20, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x2A, 0x22, 0x2C, 0x20, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x5F, 0x22, 0x2C, 0x20, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x21, 0x22, 0x2C, 0x20, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x60, 0x22, 0x0A, 0x20, 0x20, 0x5D, 0x2C, 
+    0x0A, 0x20, 0x20, 0x22, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 
+    0x64, 0x73, 0x33, 0x22, 0x3A, 0x20, 0x5B, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x22, 0x2D, 0x20, 0x22, 0x2C, 0x20, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x22, 0x2B, 0x20, 0x22, 0x2C, 0x20, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x2A, 0x20, 0x22, 0x2C, 0x20, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x7C, 0x22, 0x2C, 0x20, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x2A, 0x2A, 0x5C, 0x5C, 
+    0x2A, 0x2A, 0x22, 0x2C, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x22, 0x2A, 0x2A, 0x5C, 0x5C, 0x5F, 0x2A, 0x2A, 0x22, 0x0A, 
+    0x20, 0x20, 0x5D, 0x0A, 0x7D, 0x00, 
 };
 
 const char* bundle[] = {
@@ -2490,6 +2818,68 @@ const char* bundle[] = {
     bundle14,
     bundle15,
     bundle16,
+    bundle17,
+};
+
+const char* bundle_name[] = {
+    "C",
+    "C++",
+    "CSS",
+    "Go",
+    "HTML",
+    "Java",
+    "JavaScript",
+    "JSON",
+    "Makefile",
+    "PHP",
+    "Python",
+    "Ruby",
+    "Rust",
+    "Shell",
+    "SQL",
+    "TypeScript",
+    "zig",
+    "markdown",
+};
+
+const char* bundle_exts0[] = {".c", ".h", NULL};
+const char* bundle_exts1[] = {".cpp", ".hpp", ".c++", ".h++", ".cc", ".hh", NULL};
+const char* bundle_exts2[] = {".css", NULL};
+const char* bundle_exts3[] = {".go", NULL};
+const char* bundle_exts4[] = {".html", ".htm", NULL};
+const char* bundle_exts5[] = {".java", NULL};
+const char* bundle_exts6[] = {".js", ".mjs", ".cjs", NULL};
+const char* bundle_exts7[] = {".json", NULL};
+const char* bundle_exts8[] = {"Makefile", "makefile", "GNUmakefile", ".mak", ".mk", NULL};
+const char* bundle_exts9[] = {".php", ".phtml", NULL};
+const char* bundle_exts10[] = {".py", NULL};
+const char* bundle_exts11[] = {".rb", ".rake", ".gemspec", NULL};
+const char* bundle_exts12[] = {".rs", NULL};
+const char* bundle_exts13[] = {".sh", ".bash", ".zsh", NULL};
+const char* bundle_exts14[] = {".sql", NULL};
+const char* bundle_exts15[] = {".ts", ".tsx", NULL};
+const char* bundle_exts16[] = {".zig", NULL};
+const char* bundle_exts17[] = {".md", ".markdown", "README", "README.md", NULL};
+
+const char** bundle_exts[] = {
+    bundle_exts0,
+    bundle_exts1,
+    bundle_exts2,
+    bundle_exts3,
+    bundle_exts4,
+    bundle_exts5,
+    bundle_exts6,
+    bundle_exts7,
+    bundle_exts8,
+    bundle_exts9,
+    bundle_exts10,
+    bundle_exts11,
+    bundle_exts12,
+    bundle_exts13,
+    bundle_exts14,
+    bundle_exts15,
+    bundle_exts16,
+    bundle_exts17,
 };
 
 #endif
@@ -1,5 +1,8 @@
 #include <stdio.h>
 
+#define JSON_IMPLEMENTATION
+#include "../src/json.h"
+
 #define ARGS_SHIFT()                                                                               \
   {                                                                                                \
     argc--;                                                                                        \
@@ -7,6 +10,52 @@
   }                                                                                                \
   while (0)
 
+// Arena size for JSON parsing (4KB)
+#define ARENA_SIZE (1 << 12)
+
+// Write a C string literal, escaping anything that is not printable ASCII
+static void writeStringLiteral(FILE *out, const char *str)
+{
+  fputc('"', out);
+  for (const unsigned char *p = (const unsigned char *) str; *p; p++)
+  {
+    if (*p == '"' || *p == '\\')
+    {
+      fprintf(out, "\\%c", *p);
+    }
+    else if (*p < 0x20 || *p >= 0x7F)
+    {
+      fprintf(out, "\\%03o", *p);
+    }
+    else
+    {
+      fputc(*p, out);
+    }
+  }
+  fputc('"', out);
+}
+
+// Read the whole file into a null-terminated buffer
+static char *readFile(const char *path)
+{
+  FILE *fp = fopen(path, "rb");
+  if (!fp)
+    return NULL;
+
+  fseek(fp, 0, SEEK_END);
+  long size = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+
+  char *buffer = calloc(1, size + 1);
+  if (!buffer || (size > 0 && fread(buffer, size, 1, fp) != 1))
+  {
+    free(buffer);
+    buffer = NULL;
+  }
+  fclose(fp);
+  return buffer;
+}
+
 int main(int argc, char *argv[])
 {
   if (argc < 3)
@@ -29,40 +78,65 @@ int main(int argc, char *argv[])
   fprintf(out, "#ifndef BUNDLE_H\n");
   fprintf(out, "#define BUNDLE_H\n\n");
 
+  JsonArena arena;
+  json_arena_init(&arena, ARENA_SIZE);
+
+  // Name and extensions of each file, so the editor can index the bundled
+  // syntax at startup without parsing any JSON.
+  const char **names = calloc(argc, sizeof(const char *));
+  JsonArray  **exts  = calloc(argc, sizeof(JsonArray *));
+
   for (int i = 0; i < argc; i++)
   {
-    FILE *fp = fopen(argv[i], "r");
-    if (!fp)
+    char *json = readFile(argv[i]);
+    if (!json)
     {
       fprintf(stderr, "Failed to open %s to read.\n", argv[i]);
       return 1;
     }
 
-    fprintf(out, "const char bundle%d[] = {", i);
+    JsonValue *value = json_parse(json, &arena);
+    JsonValue *name  = NULL;
+    JsonValue *ext   = NULL;
+    if (value->type == JSON_OBJECT)
+    {
+      name = json_object_find(value->object, "name");
+      ext  = json_object_find(value->object, "extensions");
+    }
 
-    int index = 0;
+    if (!name || name->type != JSON_STRING || !ext || ext->type != JSON_ARRAY)
+    {
+      fprintf(stderr, "%s: Invalid syntax file.\n", argv[i]);
+      return 1;
+    }
 
-    int should_read = 1;
-    while (should_read)
+    for (size_t j = 0; j < ext->array->size; j++)
     {
-      int byte = fgetc(fp);
-      if (byte == EOF)
+      if (ext->array->data[j]->type != JSON_STRING)
       {
-        // Makes it null-terminated
-        byte        = 0;
-        should_read = 0;
+        fprintf(stderr, "%s: Invalid extension.\n", argv[i]);
+        return 1;
       }
+    }
+
+    names[i] = name->string;
+    exts[i]  = ext->array;
+
+    fprintf(out, "const char bundle%d[] = {", i);
 
+    // Makes it null-terminated
+    size_t size = strlen(json) + 1;
+    for (size_t index = 0; index < size; index++)
+    {
       if (index % 10 == 0)
       {
         fprintf(out, "\n    ");
       }
-      fprintf(out, "0x%02X, ", byte);
-      index++;
+      fprintf(out, "0x%02X, ", (unsigned char) json[index]);
     }
 
     fprintf(out, "\n};\n\n");
-    fclose(fp);
+    free(json);
   }
 
   fprintf(out, "const char* bundle[] = {\n");
@@ -72,7 +146,39 @@ int main(int argc, char *argv[])
   }
   fprintf(out, "};\n\n");
 
+  fprintf(out, "const char* bundle_name[] = {\n");
+  for (int i = 0; i < argc; i++)
+  {
+    fprintf(out, "    ");
+    writeStringLiteral(out, names[i]);
+    fprintf(out, ",\n");
+  }
+  fprintf(out, "};\n\n");
+
+  for (int i = 0; i < argc; i++)
+  {
+    fprintf(out, "const char* bundle_exts%d[] = {", i);
+    for (size_t j = 0; j < exts[i]->size; j++)
+    {
+      writeStringLiteral(out, exts[i]->data[j]->string);
+      fprintf(out, ", ");
+    }
+    fprintf(out, "NULL};\n");
+  }
+  fprintf(out, "\n");
+
+  fprintf(out, "const char** bundle_exts[] = {\n");
+  for (int i = 0; i < argc; i++)
+  {
+    fprintf(out, "    bundle_exts%d,\n", i);
+  }
+  fprintf(out, "};\n\n");
+
   fprintf(out, "#endif\n");
   fclose(out);
+
+  free(names);
+  free(exts);
+  json_arena_deinit(&arena);
   return 0;
 }
@@ -0,0 +1,153 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "width_intervals.h"
+
+#ifdef WIDTH_CHECK
+// Built again as widthcheck, with the lookup the editor runs on the table
+#include "../src/common.h"
+#include "../src/unicode.c"
+#else
+// Code points covered by the table, everything above is one column wide
+#define WIDTH_TABLE_LIMIT 0x110000
+
+// Code points per block of the second stage
+#define WIDTH_BLOCK_BITS 8
+#define WIDTH_BLOCK_SIZE (1 << WIDTH_BLOCK_BITS)
+#endif
+
+#define BLOCK_COUNT (WIDTH_TABLE_LIMIT / WIDTH_BLOCK_SIZE)
+
+static bool inTable(uint32_t ucs, const struct interval *table, int max)
+{
+  int min = 0;
+  if (ucs < table[0].start || ucs > table[max].end)
+    return false;
+  while (max >= min)
+  {
+    int mid = (min + max) / 2;
+    if (ucs > table[mid].end)
+      min = mid + 1;
+    else if (ucs < table[mid].start)
+      max = mid - 1;
+    else
+      return true;
+  }
+  return false;
+}
+
+// Width of a code point from the interval tables, the reference for the table
+static int intervalWidth(uint32_t ucs)
+{
+  if (ucs == 0)
+    return 0;
+
+  if (ucs < 32 || (ucs >= 0x7F && ucs < 0xA0))
+    return -1;
+
+  if (inTable(ucs, double_width, sizeof(double_width) / sizeof(double_width[0]) - 1))
+    return 2;
+  if (inTable(ucs, zero_width, sizeof(zero_width) / sizeof(zero_width[0]) - 1))
+    return 0;
+  return 1;
+}
+
+#ifdef WIDTH_CHECK
+int main(void)
+{
+  // Check every code point and the ones past the table through unicodeWidth()
+  for (uint32_t ucs = 0; ucs < WIDTH_TABLE_LIMIT + WIDTH_BLOCK_SIZE; ucs++)
+  {
+    if (unicodeWidth(ucs) != intervalWidth(ucs))
+    {
+      fprintf(stderr, "Width table mismatch at U+%04X.\n", (unsigned) ucs);
+      return 1;
+    }
+  }
+  return 0;
+}
+#else
+int main(int argc, char *argv[])
+{
+  if (argc != 2)
+  {
+    fprintf(stderr, "Usage: %s <output file>\n", argv[0]);
+    return 1;
+  }
+
+  static int8_t  blocks[BLOCK_COUNT][WIDTH_BLOCK_SIZE];
+  static uint8_t index[BLOCK_COUNT];
+  int            block_count = 0;
+
+  // Identical blocks are stored once
+  for (int i = 0; i < BLOCK_COUNT; i++)
+  {
+    int8_t block[WIDTH_BLOCK_SIZE];
+    for (int j = 0; j < WIDTH_BLOCK_SIZE; j++)
+    {
+      block[j] = intervalWidth(i * WIDTH_BLOCK_SIZE + j);
+    }
+
+    int found = 0;
+    while (found < block_count && memcmp(blocks[found], block, sizeof(block)) != 0)
+    {
+      found++;
+    }
+
+    if (found == block_count)
+    {
+      if (block_count > UINT8_MAX)
+      {
+        fprintf(stderr, "Too many distinct width blocks.\n");
+        return 1;
+      }
+      memcpy(blocks[block_count++], block, sizeof(block));
+    }
+    index[i] = found;
+  }
+
+  FILE *out = fopen(argv[1], "w");
+  if (!out)
+  {
+    fprintf(stderr, "Failed to open %s to write.\n", argv[1]);
+    return 1;
+  }
+
+  fprintf(out, "#ifndef WIDTH_TABLE_H\n");
+  fprintf(out, "#define WIDTH_TABLE_H\n\n");
+  fprintf(out, "// Generated by widthgen from width_intervals.h\n\n");
+  fprintf(out, "#define WIDTH_TABLE_LIMIT 0x%X\n", WIDTH_TABLE_LIMIT);
+  fprintf(out, "#define WIDTH_BLOCK_BITS %d\n", WIDTH_BLOCK_BITS);
+  fprintf(out, "#define WIDTH_BLOCK_SIZE (1 << WIDTH_BLOCK_BITS)\n\n");
+
+  fprintf(out, "static const uint8_t width_index[%d] = {", BLOCK_COUNT);
+  for (int i = 0; i < BLOCK_COUNT; i++)
+  {
+    if (i % 16 == 0)
+      fprintf(out, "\n    ");
+    fprintf(out, "%d, ", index[i]);
+  }
+  fprintf(out, "\n};\n\n");
+
+  fprintf(out, "static const int8_t width_blocks[%d][WIDTH_BLOCK_SIZE] = {\n", block_count);
+  for (int i = 0; i < block_count; i++)
+  {
+    fprintf(out, "    {");
+    for (int j = 0; j < WIDTH_BLOCK_SIZE; j++)
+    {
+      if (j % 32 == 0)
+        fprintf(out, "\n        ");
+      fprintf(out, "%d, ", blocks[i][j]);
+    }
+    fprintf(out, "\n    },\n");
+  }
+  fprintf(out, "};\n\n");
+
+  fprintf(out, "#endif\n");
+  fclose(out);
+  return 0;
+}
+#endif
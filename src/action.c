@@ -1,6 +1,12 @@
 #include "action.h"
 
+#include <errno.h>
+
 #include "editor.h"
+#include "prompt.h"
+
+static EditAction *pageIn(EditorActionList *node, EditAction *paged);
+static void        pageOut(EditAction *edit, EditAction *paged);
 
 /**
  * editorUndo - Undo the last action performed in the editor
@@ -11,15 +17,22 @@ bool editorUndo(void)
 {
   // Check if we're at the beginning of action history (nothing to undo)
   if (gCurFile->action_current == gCurFile->action_head)
+  {
+    if (gCurFile->largefile & LARGEFILE_UNDO)
+      editorMsg("Undo is off in large file mode.");
     return false;
+  }
 
   // Handle different action types
   switch (gCurFile->action_current->action->type)
   {
     case ACTION_EDIT:
     {
-      // Get the edit action details
-      EditAction *edit = &gCurFile->action_current->action->edit;
+      // Get the edit action details, read back from disk if it was spilled
+      EditAction  paged;
+      EditAction *edit = pageIn(gCurFile->action_current, &paged);
+      if (!edit)
+        return false;
       
       // Delete the text that was added
       editorDeleteText(edit->added_range);
@@ -30,6 +43,7 @@ bool editorUndo(void)
       
       // Restore the old cursor position
       gCurFile->cursor = edit->old_cursor;
+      pageOut(edit, &paged);
     }
     break;
 
@@ -64,16 +78,16 @@ bool editorRedo(void)
   if (!gCurFile->action_current->next)
     return false;
 
-  // Move current action pointer to next action
-  gCurFile->action_current = gCurFile->action_current->next;
-
   // Handle different action types
-  switch (gCurFile->action_current->action->type)
+  switch (gCurFile->action_current->next->action->type)
   {
     case ACTION_EDIT:
     {
-      // Get the edit action details
-      EditAction *edit = &gCurFile->action_current->action->edit;
+      // Get the edit action details, read back from disk if it was spilled
+      EditAction  paged;
+      EditAction *edit = pageIn(gCurFile->action_current->next, &paged);
+      if (!edit)
+        return false;
       
       // Delete the text that was previously there
       editorDeleteText(edit->deleted_range);
@@ -83,13 +97,14 @@ bool editorRedo(void)
       
       // Restore the new cursor position
       gCurFile->cursor = edit->new_cursor;
+      pageOut(edit, &paged);
     }
     break;
 
     case ACTION_ATTRI:
     {
       // Get the attribute action details
-      AttributeAction *attri = &gCurFile->action_current->action->attri;
+      AttributeAction *attri = &gCurFile->action_current->next->action->attri;
       
       // Restore the new newline setting
       gCurFile->newline      = attri->new_newline;
@@ -97,18 +112,264 @@ bool editorRedo(void)
     break;
   }
 
+  // Move current action pointer to next action
+  gCurFile->action_current = gCurFile->action_current->next;
+
   // Increment dirty flag (file modification counter)
   gCurFile->dirty++;
   
   return true;
 }
 
+// Action records are allocated in blocks and reused after they are freed
+#define ACTION_POOL_BLOCK 256
+
+/**
+ * struct ActionRecord - A node of the history and its action
+ * @node: The node, its next field links the free records
+ * @action: The action of the node
+ * @size: Bytes of memory the record and its text take
+ * @spill_offset: Where the text of the action is in the spill file
+ * @spill_size: Bytes of the text in the spill file, 0 if it is in memory
+ */
+typedef struct ActionRecord
+{
+  EditorActionList node;
+  EditorAction     action;
+  size_t           size;
+  long             spill_offset;
+  size_t           spill_size;
+} ActionRecord;
+
+static ActionRecord *pool_free = NULL;
+static VECTOR(ActionRecord *) pool_blocks;
+
+// Undo history of all files, the spill file is only appended to
+static EditorUndoStats stats;
+static FILE           *spill_fp  = NULL;
+static long            spill_end = 0;
+
+/**
+ * newRecord - Take an empty node of the history from the pool
+ *
+ * Returns: The node, its action points into the same record
+ */
+static EditorActionList *newRecord(void)
+{
+  if (!pool_free)
+  {
+    ActionRecord *block = malloc_s(sizeof(ActionRecord) * ACTION_POOL_BLOCK);
+    for (int i = 0; i < ACTION_POOL_BLOCK; i++)
+    {
+      block[i].node.next =
+          (i + 1 < ACTION_POOL_BLOCK) ? (EditorActionList *) &block[i + 1] : NULL;
+    }
+    vector_push(pool_blocks, block);
+    pool_free = block;
+  }
+
+  ActionRecord *record = pool_free;
+  pool_free            = (ActionRecord *) record->node.next;
+  memset(record, 0, sizeof(ActionRecord));
+  record->node.action = &record->action;
+  return &record->node;
+}
+
+static size_t clipboardSize(const EditorClipboard *clipboard)
+{
+  size_t size = sizeof(Str) * clipboard->size;
+  for (size_t i = 0; i < clipboard->size; i++)
+  {
+    size += clipboard->lines[i].size;
+  }
+  return size;
+}
+
+/**
+ * setRecordSize - Account for the memory of a record
+ * @file: The file the record belongs to
+ * @record: The record
+ * @size: Bytes the record takes now
+ */
+static void setRecordSize(EditorFile *file, ActionRecord *record, size_t size)
+{
+  file->undo_size += size - record->size;
+  stats.memory += size - record->size;
+  record->size = size;
+}
+
+static void measureRecord(EditorFile *file, ActionRecord *record)
+{
+  size_t size = sizeof(ActionRecord);
+  if (record->action.type == ACTION_EDIT)
+  {
+    size += clipboardSize(&record->action.edit.deleted_text);
+    size += clipboardSize(&record->action.edit.added_text);
+  }
+  setRecordSize(file, record, size);
+}
+
+/**
+ * writeClipboard - Append the lines of a clipboard to the spill file
+ * @clipboard: The lines
+ *
+ * Writes the line count, the line sizes, then the text of the lines, so
+ * reading it back takes one allocation for the text.
+ *
+ * Returns: false on a write error
+ */
+static bool writeClipboard(const EditorClipboard *clipboard)
+{
+  if (fwrite(&clipboard->size, sizeof(size_t), 1, spill_fp) != 1)
+    return false;
+  for (size_t i = 0; i < clipboard->size; i++)
+  {
+    if (fwrite(&clipboard->lines[i].size, sizeof(int), 1, spill_fp) != 1)
+      return false;
+  }
+  for (size_t i = 0; i < clipboard->size; i++)
+  {
+    size_t size = clipboard->lines[i].size;
+    if (fwrite(clipboard->lines[i].data, 1, size, spill_fp) != size)
+      return false;
+  }
+  return true;
+}
+
+/**
+ * readClipboard - Read the lines of a clipboard from the spill file
+ * @clipboard: Set to the lines, they share one buffer
+ *
+ * Returns: false on a read error, @clipboard is empty then
+ */
+static bool readClipboard(EditorClipboard *clipboard)
+{
+  memset(clipboard, 0, sizeof(EditorClipboard));
+
+  size_t count;
+  if (fread(&count, sizeof(size_t), 1, spill_fp) != 1)
+    return false;
+  if (count == 0)
+    return true;
+
+  Str   *lines = malloc_s(sizeof(Str) * count);
+  size_t total = 0;
+  for (size_t i = 0; i < count; i++)
+  {
+    if (fread(&lines[i].size, sizeof(int), 1, spill_fp) != 1 || lines[i].size < 0)
+    {
+      free(lines);
+      return false;
+    }
+    total += lines[i].size;
+  }
+
+  char *buf = malloc_s(total ? total : 1);
+  if (fread(buf, 1, total, spill_fp) != total)
+  {
+    free(buf);
+    free(lines);
+    return false;
+  }
+  for (size_t i = 0, offset = 0; i < count; i++)
+  {
+    lines[i].data = &buf[offset];
+    offset += lines[i].size;
+  }
+
+  clipboard->size  = count;
+  clipboard->lines = lines;
+  clipboard->buf   = buf;
+  return true;
+}
+
+/**
+ * spillRecord - Move the text of an edit action to the spill file
+ * @file: The file the record belongs to
+ * @record: The record, its text is freed
+ *
+ * Returns: false if the text couldn't be written and stays in memory
+ */
+static bool spillRecord(EditorFile *file, ActionRecord *record)
+{
+  if (!spill_fp)
+  {
+    spill_fp  = tmpfile();
+    spill_end = 0;
+    if (!spill_fp)
+      return false;
+  }
+
+  // A failed write leaves garbage past spill_end, the next one overwrites it
+  EditAction *edit = &record->action.edit;
+  if (fseek(spill_fp, spill_end, SEEK_SET) != 0 || !writeClipboard(&edit->deleted_text) ||
+      !writeClipboard(&edit->added_text) || fflush(spill_fp) != 0)
+    return false;
+
+  long end = ftell(spill_fp);
+  if (end <= spill_end)
+    return false;
+
+  record->spill_offset = spill_end;
+  record->spill_size   = end - spill_end;
+  spill_end            = end;
+  stats.spilled += record->spill_size;
+
+  editorFreeClipboardContent(&edit->deleted_text);
+  editorFreeClipboardContent(&edit->added_text);
+  edit->capacity = 0;
+  setRecordSize(file, record, sizeof(ActionRecord));
+  return true;
+}
+
+/**
+ * pageIn - Get the edit action of a node with its text in memory
+ * @node: The node, its action is an edit
+ * @paged: Storage for the action if its text has to be read from disk
+ *
+ * Returns: The action, NULL if its text couldn't be read
+ */
+static EditAction *pageIn(EditorActionList *node, EditAction *paged)
+{
+  ActionRecord *record = (ActionRecord *) node;
+  if (!record->spill_size)
+    return &record->action.edit;
+
+  *paged = record->action.edit;
+  if (fseek(spill_fp, record->spill_offset, SEEK_SET) == 0 &&
+      readClipboard(&paged->deleted_text))
+  {
+    if (readClipboard(&paged->added_text))
+      return paged;
+    editorFreeClipboardContent(&paged->deleted_text);
+  }
+  editorMsg("Can't read the undo history! %s", ferror(spill_fp) ? strerror(errno) : "");
+  clearerr(spill_fp);
+  return NULL;
+}
+
+/**
+ * pageOut - Free the text read by pageIn
+ * @edit: The action pageIn returned
+ * @paged: The storage given to pageIn
+ *
+ * The text stays in the spill file for the next undo or redo.
+ */
+static void pageOut(EditAction *edit, EditAction *paged)
+{
+  if (edit != paged)
+    return;
+  editorFreeClipboardContent(&paged->deleted_text);
+  editorFreeClipboardContent(&paged->added_text);
+}
+
 /**
  * editorAppendAction - Add a new action to the action history
  * @action: The action to append to the history
  * 
  * This function adds a new action to the undo/redo history and handles
- * clearing any redo history after the current position.
+ * clearing any redo history after the current position. The history
+ * takes over the content of the action.
  */
 void editorAppendAction(EditorAction *action)
 {
@@ -116,41 +377,316 @@ void editorAppendAction(EditorAction *action)
   if (!action)
     return;
 
-  // Allocate memory for new action list node
-  EditorActionList *node = malloc_s(sizeof(EditorActionList));
-  node->action           = action;
-  node->next             = NULL;
+  // Large files keep no history, only mark the file as modified
+  if (gCurFile->largefile & LARGEFILE_UNDO)
+  {
+    gCurFile->dirty++;
+    editorFreeAction(action);
+    return;
+  }
+
+  // The previous action is done growing
+  editorSealAction(gCurFile);
+
+  // Take a node for the action from the pool
+  EditorActionList *node = newRecord();
+  *node->action          = *action;
+  measureRecord(gCurFile, (ActionRecord *) node);
 
   // Increment dirty flag (file has been modified)
   gCurFile->dirty++;
 
   // Free any actions after current position (clear redo history)
-  editorFreeActionList(gCurFile->action_current->next);
-
-  // Special case: if we're at the head (dummy node)
-  if (gCurFile->action_current == gCurFile->action_head)
-  {
-    // Link the new node after the head
-    gCurFile->action_head->next = node;
-    node->prev                  = gCurFile->action_head;
-    gCurFile->action_current    = node;
-    return;
-  }
+  editorFreeActionList(gCurFile, gCurFile->action_current->next);
 
   // Link the new node after current action
   node->prev                     = gCurFile->action_current;
   gCurFile->action_current->next = node;
   
   // Move current pointer to the newly added action
-  gCurFile->action_current       = gCurFile->action_current->next;
+  gCurFile->action_current       = node;
+
+  editorCheckUndoBudget();
+}
+
+/**
+ * openAction - Get the action that typing may still extend
+ *
+ * Returns: The open edit action of the current file, or NULL
+ */
+static EditAction *openAction(void)
+{
+  EditorActionList *current = gCurFile->action_current;
+  if (current == gCurFile->action_head || current->action->type != ACTION_EDIT ||
+      !current->action->edit.open)
+    return NULL;
+  return &current->action->edit;
+}
+
+/**
+ * growText - Make room in the text line of an open action
+ * @edit: The action
+ * @text: Its only added or deleted line
+ * @size: Bytes needed
+ *
+ * Grows the line by doubling, so a typed run reallocates rarely.
+ */
+static void growText(EditAction *edit, Str *text, int size)
+{
+  if (size <= edit->capacity)
+    return;
+
+  int capacity = edit->capacity ? edit->capacity : 32;
+  while (capacity < size)
+  {
+    capacity *= 2;
+  }
+  text->data     = realloc_s(text->data, capacity);
+  edit->capacity = capacity;
+}
+
+/**
+ * joinInsert - Add inserted text to the end of an edit action
+ * @edit: The action
+ * @range: Where the text was inserted, on one row
+ * @s: The text
+ *
+ * Returns: true if the text follows the added text of @edit
+ */
+static bool joinInsert(EditAction *edit, EditorSelectRange range, const char *s)
+{
+  if (edit->added_text.size != 1 || edit->added_text.buf || range.start_y != range.end_y ||
+      edit->added_range.end_y != range.start_y || edit->added_range.end_x != range.start_x)
+    return false;
+
+  Str *text = &edit->added_text.lines[0];
+  int  len  = range.end_x - range.start_x;
+  growText(edit, text, text->size + len);
+  memcpy(&text->data[text->size], s, len);
+  text->size += len;
+  edit->added_range.end_x = range.end_x;
+  return true;
+}
+
+/**
+ * joinDelete - Add deleted text to an edit action that only deletes
+ * @edit: The action
+ * @range: Where the text was deleted, on one row
+ * @s: The text
+ *
+ * Returns: true if the text was right before or after the deleted text
+ */
+static bool joinDelete(EditAction *edit, EditorSelectRange range, const char *s)
+{
+  if (edit->added_text.size != 0 || edit->deleted_text.size != 1 || edit->deleted_text.buf ||
+      range.start_y != range.end_y || edit->deleted_range.start_y != range.start_y)
+    return false;
+
+  Str *text = &edit->deleted_text.lines[0];
+  int  len  = range.end_x - range.start_x;
+  if (range.end_x == edit->deleted_range.start_x)
+  {
+    // Backspace, the text goes in front
+    growText(edit, text, text->size + len);
+    memmove(&text->data[len], text->data, text->size);
+    memcpy(text->data, s, len);
+    edit->deleted_range.start_x = range.start_x;
+  }
+  else if (range.start_x == edit->deleted_range.start_x)
+  {
+    // Delete, the text goes after
+    growText(edit, text, text->size + len);
+    memcpy(&text->data[text->size], s, len);
+    edit->deleted_range.end_x += len;
+  }
+  else
+  {
+    return false;
+  }
+  text->size += len;
+  return true;
+}
+
+bool editorExtendInsert(EditorSelectRange range)
+{
+  EditAction *edit = openAction();
+  if (!edit || !joinInsert(edit, range, &gCurFile->row[range.start_y].data[range.start_x]))
+    return false;
+
+  ActionRecord *record = (ActionRecord *) gCurFile->action_current;
+  setRecordSize(gCurFile, record, record->size + range.end_x - range.start_x);
+  return true;
+}
+
+bool editorExtendDelete(EditorSelectRange range)
+{
+  EditAction *edit = openAction();
+  if (!edit || !joinDelete(edit, range, &gCurFile->row[range.start_y].data[range.start_x]))
+    return false;
+
+  ActionRecord *record = (ActionRecord *) gCurFile->action_current;
+  setRecordSize(gCurFile, record, record->size + range.end_x - range.start_x);
+  return true;
+}
+
+void editorSealAction(EditorFile *file)
+{
+  EditorActionList *current = file->action_current;
+  if (current && current != file->action_head && current->action->type == ACTION_EDIT)
+    current->action->edit.open = false;
+}
+
+/**
+ * mergeRecords - Join an action into the one before it
+ * @file: The file the records belong to
+ * @record: The earlier action
+ * @next: The action right after it, freed if it was joined
+ *
+ * Typed runs that were split by a cursor move or a save are joined back,
+ * the same way typing extends the open action.
+ *
+ * Returns: true if @next was joined
+ */
+static bool mergeRecords(EditorFile *file, ActionRecord *record, ActionRecord *next)
+{
+  if (record->spill_size || next->spill_size || record->action.type != ACTION_EDIT ||
+      next->action.type != ACTION_EDIT)
+    return false;
+
+  EditAction *edit  = &record->action.edit;
+  EditAction *after = &next->action.edit;
+  bool        joined;
+  if (after->deleted_text.size == 0 && after->added_text.size == 1)
+    joined = joinInsert(edit, after->added_range, after->added_text.lines[0].data);
+  else if (after->added_text.size == 0 && after->deleted_text.size == 1)
+    joined = joinDelete(edit, after->deleted_range, after->deleted_text.lines[0].data);
+  else
+    joined = false;
+  if (!joined)
+    return false;
+
+  edit->new_cursor = after->new_cursor;
+  record->node.next = next->node.next;
+  if (next->node.next)
+    next->node.next->prev = &record->node;
+  next->node.next = NULL;
+  editorFreeActionList(file, &next->node);
+  measureRecord(file, record);
+  return true;
+}
+
+/**
+ * compactHistory - Join the adjacent edits before the current action
+ * @file: The file
+ *
+ * Keeps the dirty count right, so undoing back to the saved text still
+ * marks the file as saved. Edits on both sides of the save aren't joined.
+ */
+static void compactHistory(EditorFile *file)
+{
+  if (!file->action_saved)
+    return;
+
+  bool saved = (file->action_saved == file->action_head);
+  for (EditorActionList *node = file->action_head->next;
+       node && node != file->action_current; node = node->next)
+  {
+    while (node != file->action_saved && node->next && node->next != file->action_current)
+    {
+      bool next_saved = (node->next == file->action_saved);
+      if (!mergeRecords(file, (ActionRecord *) node, (ActionRecord *) node->next))
+        break;
+
+      // Both edits were one step each since the save, or the save moves back
+      if (next_saved)
+        file->action_saved = node;
+      else if (saved)
+        file->dirty--;
+    }
+    if (node == file->action_saved)
+      saved = true;
+  }
+}
+
+/**
+ * trimHistory - Bring the memory of a history down
+ * @file: The file
+ * @target: Bytes of history the file may keep in memory
+ *
+ * Compacts the history, then moves the text of the oldest actions to the
+ * spill file until the file is under @target.
+ */
+static void trimHistory(EditorFile *file, size_t target)
+{
+  compactHistory(file);
+
+  for (EditorActionList *node = file->action_head->next; node && file->undo_size > target;
+       node = node->next)
+  {
+    ActionRecord *record = (ActionRecord *) node;
+    if (record->spill_size || node->action->type != ACTION_EDIT || node->action->edit.open ||
+        record->size == sizeof(ActionRecord))
+      continue;
+    if (!spillRecord(file, record))
+    {
+      editorMsg("Can't write the undo history to disk! %s", strerror(errno));
+      break;
+    }
+  }
+}
+
+void editorCheckUndoBudget(void)
+{
+  // Trim to three quarters so the next edits don't trim again
+  size_t file_budget = (size_t) CONVAR_GETINT(undo_file_budget) * 1024;
+  for (int i = 0; file_budget && i < gEditor.file_count; i++)
+  {
+    if (gEditor.files[i].undo_size > file_budget)
+      trimHistory(&gEditor.files[i], file_budget / 4 * 3);
+  }
+
+  // Take from the files with the most history first
+  size_t budget = (size_t) CONVAR_GETINT(undo_budget) * 1024;
+  if (!budget || stats.memory <= budget)
+    return;
+
+  bool trimmed[EDITOR_FILE_MAX_SLOT] = {0};
+  while (stats.memory > budget / 4 * 3)
+  {
+    int most = -1;
+    for (int i = 0; i < gEditor.file_count; i++)
+    {
+      if (!trimmed[i] && (most < 0 || gEditor.files[i].undo_size > gEditor.files[most].undo_size))
+        most = i;
+    }
+    if (most < 0)
+      break;
+
+    EditorFile *file   = &gEditor.files[most];
+    size_t      excess = stats.memory - budget / 4 * 3;
+    trimmed[most]      = true;
+    trimHistory(file, (file->undo_size > excess) ? file->undo_size - excess : 0);
+  }
+}
+
+const EditorUndoStats *editorGetUndoStats(void)
+{
+  return &stats;
+}
+
+EditorActionList *editorNewActionList(void)
+{
+  EditorActionList *head = newRecord();
+  head->action           = NULL;
+  return head;
 }
 
 /**
  * editorFreeAction - Free memory allocated for an editor action
  * @action: The action to free
  * 
- * Properly deallocates all memory associated with an action,
- * including any clipboard content for edit actions.
+ * Deallocates the clipboard content of edit actions. The action
+ * itself belongs to the caller or to the pool.
  */
 void editorFreeAction(EditorAction *action)
 {
@@ -167,19 +703,17 @@ void editorFreeAction(EditorAction *action)
     // Free the added text clipboard
     editorFreeClipboardContent(&action->edit.added_text);
   }
-
-  // Free the action structure itself
-  free(action);
 }
 
 /**
  * editorFreeActionList - Free an entire linked list of actions
+ * @file: The file the list belongs to
  * @thisptr: Pointer to the first node in the list to free
  * 
- * Recursively frees all nodes in the action list starting from
- * the given pointer.
+ * Frees the actions of all nodes starting from the given pointer
+ * and gives the nodes back to the pool.
  */
-void editorFreeActionList(EditorActionList *thisptr)
+void editorFreeActionList(EditorFile *file, EditorActionList *thisptr)
 {
   EditorActionList *temp;
   
@@ -195,7 +729,40 @@ void editorFreeActionList(EditorActionList *thisptr)
     // Free the action in current node
     editorFreeAction(temp->action);
     
-    // Free the node itself
-    free(temp);
+    // The saved text can't be reached by undo anymore
+    if (temp == file->action_saved)
+      file->action_saved = NULL;
+
+    // Give the node back
+    ActionRecord *record = (ActionRecord *) temp;
+    setRecordSize(file, record, 0);
+    stats.spilled -= record->spill_size;
+    record->node.next = (EditorActionList *) pool_free;
+    pool_free         = record;
+  }
+
+  // Nothing in the spill file is used, start over with an empty one
+  if (spill_fp && stats.spilled == 0)
+  {
+    fclose(spill_fp);
+    spill_fp  = NULL;
+    spill_end = 0;
   }
-}
\ No newline at end of file
+}
+
+void editorFreeActionPool(void)
+{
+  for (size_t i = 0; i < pool_blocks.size; i++)
+  {
+    free(pool_blocks.data[i]);
+  }
+  free(pool_blocks.data);
+  pool_blocks.data     = NULL;
+  pool_blocks.size     = 0;
+  pool_blocks.capacity = 0;
+  pool_free            = NULL;
+
+  if (spill_fp)
+    fclose(spill_fp);
+  spill_fp = NULL;
+}
@@ -3,6 +3,9 @@
 
 #include "select.h"
 
+struct EditorFile;
+typedef struct EditorFile EditorFile;
+
 /**
  * struct EditorCursor - Represents the cursor position and selection state
  * @x: Current cursor column position
@@ -30,6 +33,8 @@ typedef struct EditorCursor
  * @added_text: Content of the added text
  * @old_cursor: Cursor state before the edit
  * @new_cursor: Cursor state after the edit
+ * @open: Typed on one line, the next typed edit next to it extends it
+ * @capacity: Bytes allocated for the text of an extended action
  *
  * This structure captures all information needed to undo/redo
  * a text editing operation, including what was deleted, what was
@@ -45,6 +50,9 @@ typedef struct EditAction
 
   EditorCursor old_cursor;
   EditorCursor new_cursor;
+
+  bool open;
+  int  capacity;
 } EditAction;
 
 /**
@@ -131,26 +139,93 @@ bool editorRedo(void);
  * @action: Pointer to the action to append
  *
  * Adds the action to the end of the history and clears any
- * redo history after the current position.
+ * redo history after the current position. The history takes
+ * over the content of the action, the action itself is copied.
  */
 void editorAppendAction(EditorAction *action);
 
+/**
+ * editorExtendInsert - Add typed text to the open action
+ * @range: The text, already inserted on one row
+ *
+ * Returns: true if the open action of the current file now covers the
+ * text, false if the text needs an action of its own
+ */
+bool editorExtendInsert(EditorSelectRange range);
+
+/**
+ * editorExtendDelete - Add deleted text to the open action
+ * @range: The text, on one row and not deleted yet
+ *
+ * Returns: true if the open action of the current file now covers the
+ * text, false if the text needs an action of its own
+ */
+bool editorExtendDelete(EditorSelectRange range);
+
+/**
+ * editorSealAction - Stop extending the last action of a file
+ * @file: The file
+ */
+void editorSealAction(EditorFile *file);
+
+/**
+ * editorCheckUndoBudget - Keep the undo history within its memory budget
+ *
+ * Joins adjacent edits and moves the text of the oldest actions to a
+ * temporary file when a file goes over undo_file_budget or all files go
+ * over undo_budget. Undo and redo read the text back when they need it.
+ */
+void editorCheckUndoBudget(void);
+
+/**
+ * struct EditorUndoStats - Memory used by the undo history of all files
+ * @memory: Bytes of history in memory
+ * @spilled: Bytes of history moved to the spill file
+ */
+typedef struct EditorUndoStats
+{
+  size_t memory;
+  size_t spilled;
+} EditorUndoStats;
+
+/**
+ * editorGetUndoStats - Get the memory used by the undo history
+ *
+ * Returns: Pointer to the statistics
+ */
+const EditorUndoStats *editorGetUndoStats(void);
+
+/**
+ * editorNewActionList - Create an empty history
+ *
+ * Returns: The head of the history, it holds no action
+ */
+EditorActionList *editorNewActionList(void);
+
 /**
  * editorFreeActionList - Free a list of actions
+ * @file: The file the list belongs to
  * @thisptr: Pointer to the first node to free
  *
- * Recursively frees all nodes in the action list starting
- * from the given pointer.
+ * Gives all nodes in the action list starting from the given
+ * pointer back to the pool.
  */
-void editorFreeActionList(EditorActionList *thisptr);
+void editorFreeActionList(EditorFile *file, EditorActionList *thisptr);
 
 /**
- * editorFreeAction - Free a single action
- * @action: Pointer to the action to free
+ * editorFreeAction - Free the content of an action
+ * @action: Pointer to the action
  *
- * Frees all memory associated with the action, including
- * any clipboard content for edit actions.
+ * Frees the clipboard content of edit actions, not the action
+ * itself.
  */
 void editorFreeAction(EditorAction *action);
 
+/**
+ * editorFreeActionPool - Free the memory of the action records
+ *
+ * Must be called after every history is freed.
+ */
+void editorFreeActionPool(void);
+
 #endif
\ No newline at end of file
@@ -3,16 +3,23 @@
 #include "buildnum.h"
 #include "editor.h"
 #include "input.h"
+#include "output.h"
 #include "prompt.h"
+#include "screen.h"
 #include "terminal.h"
+#include "unicode.h"
 
 EditorConCmdArgs args;
 
+static void cvarTabsizeCallback(void);
 static void cvarSyntaxCallback(void);
 static void cvarExplorerCallback(void);
 static void cvarMouseCallback(void);
+static void cvarWrapCallback(void);
+static void cvarColormodeCallback(void);
+static void cvarUndoCallback(void);
 
-CONVAR(tabsize, "Tab size.", "4", cvarSyntaxCallback);
+CONVAR(tabsize, "Tab size.", "4", cvarTabsizeCallback);
 CONVAR(whitespace, "Use whitespace instead of tab.", "1", NULL);
 CONVAR(autoindent, "Enable auto indent.", "0", NULL);
 CONVAR(backspace, "Use hungry backspace.", "1", NULL);
@@ -33,6 +40,23 @@ CONVAR(newline_default, "Set the default EOL sequence (LF/CRLF). 0 is OS default
 CONVAR(ttimeoutlen, "Time in milliseconds to wait for a key code sequence to complete.", "50",
        NULL);
 CONVAR(lilex, "Show line numbers.", "1", NULL);
+CONVAR(largefile_size, "File size in KB from which large file mode is used. 0 is no limit.",
+       "32768", NULL);
+CONVAR(largefile_lines, "Line count from which large file mode is used. 0 is no limit.", "500000",
+       NULL);
+CONVAR(longline_size, "Row size in KB from which edits only update the text near them. 0 is never.",
+       "64", NULL);
+CONVAR(fullredraw, "Redraw the whole screen instead of only the changed cells.", "0", NULL);
+CONVAR(syncoutput, "Wrap each frame in a synchronized update so it never shows half drawn.", "1",
+       NULL);
+CONVAR(maxfps, "Maximum screen refreshes per second while typing. 0 is no limit.", "60", NULL);
+CONVAR(wrap, "Wrap long lines instead of scrolling horizontally.", "0", cvarWrapCallback);
+CONVAR(colormode, "Colors of the terminal: truecolor, 256 or 16.", "truecolor",
+       cvarColormodeCallback);
+CONVAR(undo_file_budget, "Undo history in KB a file keeps in memory. 0 is no limit.", "65536",
+       cvarUndoCallback);
+CONVAR(undo_budget, "Undo history in KB all files keep in memory. 0 is no limit.", "262144",
+       cvarUndoCallback);
 
 static void reloadSyntax(void)
 {
@@ -48,14 +72,13 @@ static void reloadSyntax(void)
 static void reloadExplorer(void)
 {
   if (gEditor.explorer.node)
-  {
-    gEditor.explorer.node          = editorExplorerCreate(".");
-    gEditor.explorer.node->is_open = true;
-    editorExplorerRefresh();
+    editorExplorerReload();
+}
 
-    gEditor.explorer.offset         = 0;
-    gEditor.explorer.selected_index = 0;
-  }
+static void cvarTabsizeCallback(void)
+{
+  // Rows recompute their columns when they are used next
+  editorRowInvalidateColumns();
 }
 
 static void cvarSyntaxCallback(void)
@@ -88,6 +111,27 @@ static void cvarMouseCallback(void)
   }
 }
 
+static void cvarWrapCallback(void)
+{
+  // Offsets of the other mode don't apply, the index is built when drawn
+  for (int i = 0; i < gEditor.file_count; i++)
+  {
+    gEditor.files[i].col_offset  = 0;
+    gEditor.files[i].wrap_offset = 0;
+    editorWrapFree(&gEditor.files[i]);
+  }
+}
+
+static void cvarColormodeCallback(void)
+{
+  screenLoadPalette();
+}
+
+static void cvarUndoCallback(void)
+{
+  editorCheckUndoBudget();
+}
+
 const ColorElement color_element_map[EDITOR_COLOR_COUNT] = {
     {"bg", &gEditor.color_cfg.bg},
 
@@ -169,7 +213,9 @@ CON_COMMAND(color, "Change the color of an element.")
     if (!strToColor(args.argv[2], target))
     {
       editorMsg("Invalid color string \"%s\".", args.argv[2]);
+      return;
     }
+    screenLoadPalette();
   }
 }
 
@@ -214,26 +260,12 @@ CON_COMMAND(lang, "Set the syntax highlighting language of the current file.")
     return;
   }
 
-  const char *name = args.argv[1];
-  for (EditorSyntax *s = gEditor.HLDB; s; s = s->next)
+  const char   *name = args.argv[1];
+  EditorSyntax *s    = editorFindSyntaxByName(name);
+  if (s)
   {
-    // Match the language name or the externaion
-    if (strCaseCmp(name, s->file_type) == 0)
-    {
-      editorSetSyntaxHighlight(gCurFile, s);
-      return;
-    }
-
-    for (size_t i = 0; i < s->file_exts.size; i++)
-    {
-      int is_ext = (s->file_exts.data[i][0] == '.');
-      if ((is_ext && strCaseCmp(name, &s->file_exts.data[i][1]) == 0) ||
-          (!is_ext && strCaseStr(name, s->file_exts.data[i])))
-      {
-        editorSetSyntaxHighlight(gCurFile, s);
-        return;
-      }
-    }
+    editorSetSyntaxHighlight(gCurFile, s);
+    return;
   }
 
   editorMsg("lang: \"%s\" not found", name);
@@ -272,9 +304,7 @@ CON_COMMAND(hldb_reload_all, "Reload syntax highlighting database.")
 {
   UNUSED(args.argc);
 
-  editorFreeHLDB();
-  editorInitHLDB();
-  reloadSyntax();
+  editorReloadHLDB();
 }
 
 CON_COMMAND(newline, "Set the EOL sequence (LF/CRLF).")
@@ -306,14 +336,60 @@ CON_COMMAND(newline, "Set the EOL sequence (LF/CRLF).")
     return;
   }
 
-  EditorAction *action      = calloc_s(1, sizeof(EditorAction));
-  action->type              = ACTION_ATTRI;
-  action->attri.new_newline = nl;
-  action->attri.old_newline = gCurFile->newline;
+  EditorAction action      = {.type = ACTION_ATTRI};
+  action.attri.new_newline = nl;
+  action.attri.old_newline = gCurFile->newline;
 
   gCurFile->newline = nl;
 
-  editorAppendAction(action);
+  editorAppendAction(&action);
+}
+
+CON_COMMAND(largefile, "Turn large file mode of the current file on (1) or off (0).")
+{
+  if (gEditor.file_count == 0)
+  {
+    editorMsg("largefile: No file opened");
+    return;
+  }
+
+  if (args.argc == 1)
+  {
+    editorMsg("largefile: %s", gCurFile->largefile ? "1" : "0");
+    return;
+  }
+
+  if (args.argc != 2)
+  {
+    editorMsg("Usage: largefile [0/1]");
+    return;
+  }
+
+  editorSetLargeFile(gCurFile, atoi(args.argv[1]) ? LARGEFILE_ALL : 0);
+}
+
+CON_COMMAND(reload, "Reload the files that changed on disk and have no unsaved changes.")
+{
+  UNUSED(args.argc);
+
+  int reloaded = 0;
+  int skipped  = 0;
+  for (int i = 0; i < gEditor.file_count; i++)
+  {
+    EditorFile *file = &gEditor.files[i];
+    if (!file->disk_changed)
+      continue;
+
+    if (file->dirty)
+      skipped++;
+    else if (editorReload(file))
+      reloaded++;
+  }
+
+  if (skipped)
+    editorMsg("Reloaded %d file(s), skipped %d with unsaved changes.", reloaded, skipped);
+  else
+    editorMsg("Reloaded %d file(s).", reloaded);
 }
 
 int editorGetDefaultNewline(void)
@@ -375,6 +451,30 @@ CON_COMMAND(version, "Print version info string.")
   editorMsg("Exe build: %s %s (%d)", editor_build_time, editor_build_date, editorGetBuildNumber());
 }
 
+CON_COMMAND(screen_stats, "Print the bytes written to the terminal by screen updates.")
+{
+  UNUSED(args.argc);
+
+  const ScreenStats *stats = screenGetStats();
+  if (stats->frames == 0)
+    return;
+
+  editorMsg("Last frame: %zu bytes, %zu cells changed", stats->last_bytes, stats->last_cells);
+  editorMsg("%zu frames (%zu full redraws, %zu scrolls), %zu bytes per frame on average",
+            stats->frames, stats->full_frames, stats->scrolls, stats->total_bytes / stats->frames);
+}
+
+CON_COMMAND(undo_stats, "Print the memory and disk used by the undo history.")
+{
+  UNUSED(args.argc);
+
+  const EditorUndoStats *stats = editorGetUndoStats();
+  editorMsg("Undo history: %zu KB in memory, %zu KB on disk", (stats->memory + 1023) / 1024,
+            (stats->spilled + 1023) / 1024);
+  if (gEditor.file_count)
+    editorMsg("Current file: %zu KB in memory", (gCurFile->undo_size + 1023) / 1024);
+}
+
 static void showCmdHelp(const EditorConCmd *cmd)
 {
   if (cmd->has_callback)
@@ -457,6 +557,99 @@ CON_COMMAND(crash, "Cause the editor to crash. (Debug!!)")
   }
 }
 
+CON_COMMAND(bench_render, "Time building full screen frames. (Debug!!)")
+{
+  int frames = (args.argc > 1) ? strToInt(args.argv[1]) : 1000;
+  if (frames <= 0)
+  {
+    editorMsg("Usage: bench_render [frames]");
+    return;
+  }
+
+  int64_t draw_time, render_time;
+  editorBenchRefreshScreen(frames, &draw_time, &render_time);
+  editorMsg("%d frames: draw %.2f us, render %.2f us per frame", frames,
+            (double) draw_time / frames, (double) render_time / frames);
+}
+
+/**
+ * benchUTF8 - Time decoding a repeated sample text
+ * @name: Name of the sample
+ * @sample: The sample text
+ * @passes: Number of passes over 1 MB of text
+ */
+static void benchUTF8(const char *name, const char *sample, int passes)
+{
+  size_t sample_len = strlen(sample);
+  size_t size       = ((1 << 20) / sample_len) * sample_len;
+  char  *text       = malloc_s(size);
+  for (size_t i = 0; i < size; i++)
+  {
+    text[i] = sample[i % sample_len];
+  }
+
+  volatile int sink = 0;
+  int          sum  = 0;
+
+  int64_t start = getTime();
+  for (int pass = 0; pass < passes; pass++)
+  {
+    size_t i = 0;
+    while (i < size)
+    {
+      size_t byte_size;
+      sum += unicodeWidth(decodeUTF8(&text[i], size - i, &byte_size));
+      i += byte_size;
+    }
+  }
+  int64_t single_time = getTime() - start;
+
+  start = getTime();
+  for (int pass = 0; pass < passes; pass++)
+  {
+    size_t i = 0;
+    while (i < size)
+    {
+      UnicodeChar chars[UTF8_SPAN_CHUNK];
+      size_t      count = decodeUTF8Span(&text[i], size - i, chars, UTF8_SPAN_CHUNK);
+      for (size_t j = 0; j < count; j++)
+      {
+        sum += chars[j].width;
+        i += chars[j].byte_size;
+      }
+    }
+  }
+  int64_t span_time = getTime() - start;
+  sink              = sum;
+  UNUSED(sink);
+
+  double mb = (double) size * passes / (1 << 20);
+  editorMsg("%s: %.0f MB/s by character, %.0f MB/s by span", name,
+            mb * 1000000 / (single_time ? single_time : 1),
+            mb * 1000000 / (span_time ? span_time : 1));
+  free(text);
+}
+
+CON_COMMAND(bench_utf8, "Time UTF-8 decoding and width lookup. (Debug!!)")
+{
+  int passes = (args.argc > 1) ? strToInt(args.argv[1]) : 20;
+  if (passes <= 0)
+  {
+    editorMsg("Usage: bench_utf8 [passes]");
+    return;
+  }
+
+  benchUTF8("ASCII", "int main(void) { return 0; }\n", passes);
+  benchUTF8("Latin",
+            "D\xc3\xa9j\xc3\xa0 vu, \xc3\xb1"
+            "and\xc3\xba \xc3\xbc"
+            "ber Stra\xc3\x9f"
+            "e\n",
+            passes);
+  benchUTF8("CJK", "\xe4\xb8\xad\xe6\x96\x87\xe5\xad\x97\xe7\xac\xa6\xe6\xb5\x8b\xe8\xaf\x95\n",
+            passes);
+}
+
 #endif
 
 const EditorColorScheme color_default = {
@@ -803,12 +996,24 @@ void editorRegisterCommands(void)
   INIT_CONVAR(newline_default);
   INIT_CONVAR(ttimeoutlen);
   INIT_CONVAR(lilex);
+  INIT_CONVAR(largefile_size);
+  INIT_CONVAR(largefile_lines);
+  INIT_CONVAR(longline_size);
+  INIT_CONVAR(fullredraw);
+  INIT_CONVAR(syncoutput);
+  INIT_CONVAR(maxfps);
+  INIT_CONVAR(wrap);
+  INIT_CONVAR(colormode);
+  INIT_CONVAR(undo_file_budget);
+  INIT_CONVAR(undo_budget);
 
   INIT_CONCOMMAND(color);
   INIT_CONCOMMAND(lang);
   INIT_CONCOMMAND(hldb_load);
   INIT_CONCOMMAND(hldb_reload_all);
   INIT_CONCOMMAND(newline);
+  INIT_CONCOMMAND(largefile);
+  INIT_CONCOMMAND(reload);
 
   INIT_CONVAR(cmd_expand_depth);
   INIT_CONCOMMAND(alias);
@@ -819,9 +1024,13 @@ void editorRegisterCommands(void)
   INIT_CONCOMMAND(help);
   INIT_CONCOMMAND(find);
   INIT_CONCOMMAND(version);
+  INIT_CONCOMMAND(screen_stats);
+  INIT_CONCOMMAND(undo_stats);
 
 #ifdef _DEBUG
   INIT_CONCOMMAND(crash);
+  INIT_CONCOMMAND(bench_render);
+  INIT_CONCOMMAND(bench_utf8);
 #endif
 }
 
@@ -83,6 +83,9 @@ typedef struct EditorColorScheme
   Color highlightBg[HL_BG_COUNT];
 } EditorColorScheme;
 
+// Number of colors in a color scheme, the palette of the screen cells
+#define EDITOR_PALETTE_SIZE (sizeof(EditorColorScheme) / sizeof(Color))
+
 extern const EditorColorScheme color_default;
 
 EXTERN_CONVAR(tabsize);
@@ -102,6 +105,16 @@ EXTERN_CONVAR(ex_show_hidden);
 EXTERN_CONVAR(newline_default);
 EXTERN_CONVAR(ttimeoutlen);
 EXTERN_CONVAR(lilex);
+EXTERN_CONVAR(largefile_size);
+EXTERN_CONVAR(largefile_lines);
+EXTERN_CONVAR(longline_size);
+EXTERN_CONVAR(fullredraw);
+EXTERN_CONVAR(syncoutput);
+EXTERN_CONVAR(maxfps);
+EXTERN_CONVAR(wrap);
+EXTERN_CONVAR(colormode);
+EXTERN_CONVAR(undo_file_budget);
+EXTERN_CONVAR(undo_budget);
 
 void editorRegisterCommands(void);
 void editorUnregisterCommands(void);
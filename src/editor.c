@@ -1,9 +1,11 @@
 #include "editor.h"
 
 #include "config.h"
+#include "finder.h"
 #include "highlight.h"
 #include "os.h"
 #include "prompt.h"
+#include "screen.h"
 
 #include <stdlib.h>
 #include <string.h>
@@ -18,6 +20,7 @@ void editorInit(void)
   gEditor.mouse_mode = true;
 
   gEditor.color_cfg = color_default;
+  screenLoadPalette();
 
   gEditor.con_front = -1;
 
@@ -38,10 +41,13 @@ void editorFree(void)
   {
     editorFreeFile(&gEditor.files[i]);
   }
+  editorFreeActionPool();
   editorFreeClipboardContent(&gEditor.clipboard);
   editorExplorerFree();
+  editorFinderFree();
   editorFreeHLDB();
   editorUnregisterCommands();
+  screenFree();
 }
 
 void editorInitFile(EditorFile *file)
@@ -56,11 +62,35 @@ void editorFreeFile(EditorFile *file)
   {
     editorFreeRow(&file->row[i]);
   }
-  editorFreeActionList(file->action_head);
+  editorFreeActionList(file, file->action_head);
+  editorWrapFree(file);
+  watchRemove(file->watch);
   free(file->row);
   free(file->filename);
 }
 
+/**
+ * editorSetLargeFile - Turn features of a file off or back on
+ * @file: The file
+ * @flags: LARGEFILE_* features to turn off, 0 turns everything back on
+ */
+void editorSetLargeFile(EditorFile *file, uint8_t flags)
+{
+  uint8_t changed = file->largefile ^ flags;
+  file->largefile = flags;
+
+  if (changed & LARGEFILE_SYNTAX)
+    editorSetSyntaxHighlight(file, file->syntax);
+
+  // The history can't be replayed once edits go unrecorded
+  if ((changed & flags & LARGEFILE_UNDO) && file->action_head)
+  {
+    editorFreeActionList(file, file->action_head->next);
+    file->action_head->next = NULL;
+    file->action_current    = file->action_head;
+  }
+}
+
 int editorAddFile(const EditorFile *file)
 {
   if (gEditor.file_count >= EDITOR_FILE_MAX_SLOT)
@@ -72,8 +102,9 @@ int editorAddFile(const EditorFile *file)
   EditorFile *current = &gEditor.files[gEditor.file_count];
 
   *current                = *file;
-  current->action_head    = calloc_s(1, sizeof(EditorActionList));
+  current->action_head    = editorNewActionList();
   current->action_current = current->action_head;
+  current->action_saved   = current->action_head;
 
   gEditor.file_count++;
   return gEditor.file_count - 1;
@@ -7,6 +7,7 @@
 #include "os.h"
 #include "row.h"
 #include "select.h"
+#include "wrap.h"
 
 #define EDITOR_FILE_MAX_SLOT 32
 
@@ -26,8 +27,22 @@ enum EditorState
   OPEN_FILE_MODE,
   CONFIG_MODE,
   SAVE_AS_MODE,
+  FINDER_MODE,
 };
 
+/**
+ * Large file mode flags
+ *
+ * Features turned off for a file that exceeds largefile_size or
+ * largefile_lines when it is opened.
+ */
+#define LARGEFILE_SYNTAX (1 << 0)     // No syntax highlighting
+#define LARGEFILE_TRAILING (1 << 1)   // No trailing whitespace highlighting
+#define LARGEFILE_DRAWSPACE (1 << 2)  // No whitespace rendering
+#define LARGEFILE_BRACKET (1 << 3)    // No auto bracket completion
+#define LARGEFILE_UNDO (1 << 4)       // No undo history
+#define LARGEFILE_ALL 0x1F
+
 typedef struct EditorSyntax EditorSyntax;
 
 typedef struct EditorFile
@@ -45,6 +60,10 @@ typedef struct EditorFile
   int row_offset;
   int col_offset;
 
+  // Screen line of the top row shown first in wrap mode
+  int       wrap_offset;
+  WrapIndex wrap;
+
   // Total line number
   int num_rows;
   int lilex_width;
@@ -53,9 +72,11 @@ typedef struct EditorFile
   uint8_t newline;
 
   // File info
-  char    *filename;  // NULL if untitled
+  char    *filename;      // NULL if untitled
   int      new_id;
   FileInfo file_info;
+  int      watch;         // File system watch, 0 if none
+  bool     disk_changed;  // Changed on disk since it was read or saved
 
   // Text buffers
   size_t     row_capacity;
@@ -64,10 +85,15 @@ typedef struct EditorFile
   // Syntax highlight information
   EditorSyntax *syntax;
 
+  // Features turned off in large file mode
+  uint8_t largefile;
+
   // Undo redo
   int               dirty;
   EditorActionList *action_head;
   EditorActionList *action_current;
+  EditorActionList *action_saved;  // Action the file was saved after, NULL if unknown
+  size_t            undo_size;     // Bytes of history in memory
 } EditorFile;
 
 typedef struct Editor
@@ -130,6 +156,7 @@ void editorInit(void);
 void editorFree(void);
 void editorInitFile(EditorFile *file);
 void editorFreeFile(EditorFile *file);
+void editorSetLargeFile(EditorFile *file, uint8_t flags);
 
 // Multiple files control
 int  editorAddFile(const EditorFile *file);
@@ -55,29 +55,74 @@ static char *editroRowsToString(EditorFile *file, size_t *len)
   return buf;
 }
 
-static void editorExplorerFreeNode(EditorExplorerNode *node)
+/**
+ * readFile - Read the rows of a file
+ * @file: The file, empty, with its file info set
+ * @fp: The opened file, closed when done
+ * @path: Path shown in messages
+ */
+static void readFile(EditorFile *file, FILE *fp, const char *path)
 {
-  if (!node)
-    return;
+  // Turn off the expensive features before reading a large file
+  int64_t size_limit = (int64_t) CONVAR_GETINT(largefile_size) * 1024;
+  if (size_limit > 0 && getFileSize(file->file_info) >= size_limit)
+    file->largefile = LARGEFILE_ALL;
+
+  bool   has_end_nl = true;
+  bool   has_cr     = false;
+  size_t at         = 0;
+  size_t cap        = 16;
+
+  char   *line = NULL;
+  size_t  n    = 0;
+  int64_t len;
+
+  file->row          = malloc_s(sizeof(EditorRow) * cap);
+  file->row_capacity = cap;
 
-  if (node->is_directory)
+  while ((len = getLine(&line, &n, fp)) != -1)
   {
-    for (size_t i = 0; i < node->dir.count; i++)
+    has_end_nl = false;
+    while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r'))
     {
-      editorExplorerFreeNode(node->dir.nodes[i]);
+      if (line[len - 1] == '\r')
+        has_cr = true;
+      has_end_nl = true;
+      len--;
     }
 
-    for (size_t i = 0; i < node->file.count; i++)
-    {
-      editorExplorerFreeNode(node->file.nodes[i]);
-    }
+    editorInsertRow(file, at, line, len);
+    at++;
 
-    free(node->dir.nodes);
-    free(node->file.nodes);
+    if (!file->largefile && at == (size_t) CONVAR_GETINT(largefile_lines))
+      editorSetLargeFile(file, LARGEFILE_ALL);
   }
 
-  free(node->filename);
-  free(node);
+  if (file->largefile)
+    editorMsg("\"%s\" is opened in large file mode. Use \"largefile 0\" to turn it off.", path);
+
+  file->lilex_width = getDigit(file->num_rows) + 2;
+
+  if (has_end_nl)
+  {
+    editorInsertRow(file, file->num_rows, "", 0);
+  }
+
+  if (file->num_rows < 2)
+  {
+    file->newline = editorGetDefaultNewline();
+  }
+  else if (has_cr)
+  {
+    file->newline = NL_DOS;
+  }
+  else if (file->num_rows)
+  {
+    file->newline = NL_UNIX;
+  }
+
+  free(line);
+  fclose(fp);
 }
 
 bool editorOpen(EditorFile *file, const char *path)
@@ -107,17 +152,8 @@ bool editorOpen(EditorFile *file, const char *path)
     break;
 
     case FT_DIR:
-      if (gEditor.explorer.node)
-      {
-        editorExplorerFreeNode(gEditor.explorer.node);
-      }
       changeDir(path);
-      gEditor.explorer.node          = editorExplorerCreate(".");
-      gEditor.explorer.node->is_open = true;
-      editorExplorerRefresh();
-
-      gEditor.explorer.offset         = 0;
-      gEditor.explorer.selected_index = 0;
+      editorExplorerReload();
       return false;
 
     case FT_DEV:
@@ -169,55 +205,8 @@ bool editorOpen(EditorFile *file, const char *path)
     return true;
   }
 
-  bool   has_end_nl = true;
-  bool   has_cr     = false;
-  size_t at         = 0;
-  size_t cap        = 16;
-
-  char   *line = NULL;
-  size_t  n    = 0;
-  int64_t len;
-
-  file->row = malloc_s(sizeof(EditorRow) * cap);
-
-  while ((len = getLine(&line, &n, fp)) != -1)
-  {
-    has_end_nl = false;
-    while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r'))
-    {
-      if (line[len - 1] == '\r')
-        has_cr = true;
-      has_end_nl = true;
-      len--;
-    }
-
-    editorInsertRow(file, at, line, len);
-    at++;
-  }
-
-  file->lilex_width = getDigit(file->num_rows) + 2;
-
-  if (has_end_nl)
-  {
-    editorInsertRow(file, file->num_rows, "", 0);
-  }
-
-  if (file->num_rows < 2)
-  {
-    file->newline = editorGetDefaultNewline();
-  }
-  else if (has_cr)
-  {
-    file->newline = NL_DOS;
-  }
-  else if (file->num_rows)
-  {
-    file->newline = NL_UNIX;
-  }
-
-  free(line);
-  fclose(fp);
-
+  readFile(file, fp, path);
+  file->watch = watchAdd(file->filename, false);
   return true;
 }
 
@@ -272,7 +261,18 @@ bool editorSave(EditorFile *file, int save_as)
     {
       fclose(fp);
       free(buf);
-      file->dirty = 0;
+      file->dirty        = 0;
+      file->disk_changed = false;
+      file->file_info    = getFileInfo(file->filename);
+
+      // Typing after the save is a new change
+      editorSealAction(file);
+      file->action_saved = file->action_current;
+
+      // The file may be new or saved under another path
+      watchRemove(file->watch);
+      file->watch = watchAdd(file->filename, false);
+
       editorMsg("%d bytes written to disk.", len);
       return true;
     }
@@ -283,6 +283,49 @@ bool editorSave(EditorFile *file, int save_as)
   return false;
 }
 
+bool editorReload(EditorFile *file)
+{
+  FILE *fp = openFile(file->filename, "rb");
+  if (!fp)
+  {
+    editorMsg("Can't reload \"%s\"! %s", file->filename, strerror(errno));
+    return false;
+  }
+
+  EditorFile reloaded;
+  editorInitFile(&reloaded);
+  reloaded.filename  = file->filename;
+  reloaded.file_info = getFileInfo(file->filename);
+  reloaded.watch     = file->watch;
+  file->filename     = NULL;
+  file->watch        = 0;
+
+  editorSelectSyntaxHighlight(&reloaded);
+  readFile(&reloaded, fp, reloaded.filename);
+
+  // Stay at the same place, as far as the new text goes
+  EditorCursor *cursor = &reloaded.cursor;
+  *cursor              = file->cursor;
+  cursor->is_selected  = false;
+  if (cursor->y >= reloaded.num_rows)
+    cursor->y = reloaded.num_rows - 1;
+  if (cursor->x > reloaded.row[cursor->y].size)
+    cursor->x = reloaded.row[cursor->y].size;
+  reloaded.sx          = file->sx;
+  reloaded.row_offset  = (file->row_offset < cursor->y) ? file->row_offset : cursor->y;
+  reloaded.col_offset  = file->col_offset;
+  reloaded.wrap_offset = 0;
+
+  // The history was made on the old text
+  reloaded.action_head    = editorNewActionList();
+  reloaded.action_current = reloaded.action_head;
+  reloaded.action_saved   = reloaded.action_head;
+
+  editorFreeFile(file);
+  *file = reloaded;
+  return true;
+}
+
 void editorOpenFilePrompt(void)
 {
   if (gEditor.file_count >= EDITOR_FILE_MAX_SLOT)
@@ -295,6 +338,12 @@ void editorOpenFilePrompt(void)
   if (!path)
     return;
 
+  editorOpenPath(path);
+  free(path);
+}
+
+void editorOpenPath(const char *path)
+{
   EditorFile file;
   if (editorOpen(&file, path))
   {
@@ -311,122 +360,914 @@ void editorOpenFilePrompt(void)
       editorChangeToFile(index);
     }
   }
+}
 
-  free(path);
+/**
+ * struct EditorExplorerBlock - Nodes made from one listing of a directory
+ * @next: Block of an earlier listing
+ * @names: Paths of the nodes
+ * @count: Number of @nodes
+ * @live: Nodes of the block that are still children of the directory
+ * @nodes: The nodes
+ *
+ * Listing a directory again after it changed on disk only makes nodes for
+ * the new entries, the others keep theirs. A block is freed when the last
+ * of its entries is gone.
+ */
+typedef struct EditorExplorerBlock
+{
+  struct EditorExplorerBlock *next;
+  char                       *names;
+  size_t                      count;
+  size_t                      live;
+  EditorExplorerNode          nodes[];
+} EditorExplorerBlock;
+
+// Directories listed at the same time
+#define EXPLORER_SCAN_THREADS 4
+
+// Subdirectories of an opened directory listed before they are opened
+#define EXPLORER_PREFETCH_MAX 32
+
+/**
+ * struct ExplorerListing - Entries of a directory listed by a scan thread
+ * @node: The directory, only used on the UI thread, NULL once it's freed
+ * @generation: Explorer tree of @node, the listing is dropped if it changed
+ * @prefetch: Listed before the directory was opened
+ * @show_hidden: List hidden entries
+ * @path: Path of the directory
+ * @names: Paths of the entries
+ * @dirs: Sorted paths of the subdirectories, into @names
+ * @files: Sorted paths of the other entries, into @names
+ * @error: The directory can't be read
+ * @next: Next listing in the queue
+ */
+typedef struct ExplorerListing
+{
+  EditorExplorerNode     *node;
+  unsigned                generation;
+  bool                    prefetch;
+  bool                    show_hidden;
+  char                   *path;
+  abuf                    names;
+  char                  **dirs;
+  size_t                  dir_count;
+  char                  **files;
+  size_t                  file_count;
+  bool                    error;
+  struct ExplorerListing *next;
+} ExplorerListing;
+
+/**
+ * Listings waiting for a scan thread and listings waiting to be merged, both
+ * behind the mutex. Opened directories go before prefetches in the queue.
+ */
+static struct
+{
+  Mutex            mutex;
+  Cond             cond;
+  int              threads;
+  bool             started;
+  unsigned         generation;
+  ExplorerListing *jobs;
+  ExplorerListing *jobs_tail;
+  ExplorerListing *done;
+} scan;
+
+// Directories with a file system watch
+static VECTOR(EditorExplorerNode *) watched_nodes;
+
+static void initExplorerNode(EditorExplorerNode *node, char *filename, bool is_directory)
+{
+  node->filename     = filename;
+  node->is_directory = is_directory;
+  node->is_open      = false;
+  node->loaded       = false;
+  node->loading      = false;
+  node->stale        = false;
+  node->depth        = 0;
+  node->visible      = 1;
+  node->watch        = 0;
+  node->parent       = NULL;
+  node->blocks       = NULL;
+  node->listing      = NULL;
+  node->dir.count    = 0;
+  node->dir.nodes    = NULL;
+  node->file.count   = 0;
+  node->file.nodes   = NULL;
+}
+
+EditorExplorerNode *editorExplorerCreate(const char *path)
+{
+  EditorExplorerNode *node = malloc_s(sizeof(EditorExplorerNode));
+
+  int   len      = strlen(path);
+  char *filename = malloc_s(len + 1);
+  snprintf(filename, len + 1, "%s", path);
+
+  initExplorerNode(node, filename, getFileType(path) == FT_DIR);
+  return node;
+}
+
+static void watchNode(EditorExplorerNode *node)
+{
+  node->watch = watchAdd(node->filename, true);
+  if (node->watch)
+    vector_push(watched_nodes, node);
 }
 
-static void insertExplorerNode(EditorExplorerNode *node, EditorExplorerNodeData *data)
+static void unwatchNode(EditorExplorerNode *node)
 {
-  size_t i;
-  data->nodes = realloc_s(data->nodes, (data->count + 1) * sizeof(EditorExplorerNode *));
+  if (!node->watch)
+    return;
 
-  for (i = 0; i < data->count; i++)
+  // Links to the same directory share the watch
+  bool   shared = false;
+  size_t i      = 0;
+  while (i < watched_nodes.size)
   {
-    if (strcmp(data->nodes[i]->filename, node->filename) > 0)
+    if (watched_nodes.data[i] == node)
     {
-      memmove(&data->nodes[i + 1], &data->nodes[i],
-              (data->count - i) * sizeof(EditorExplorerNode *));
-      break;
+      watched_nodes.data[i] = watched_nodes.data[--watched_nodes.size];
+      continue;
     }
+    shared = shared || watched_nodes.data[i]->watch == node->watch;
+    i++;
   }
 
-  data->nodes[i] = node;
-  data->count++;
+  if (!shared)
+    watchRemove(node->watch);
+  node->watch = 0;
 }
 
-EditorExplorerNode *editorExplorerCreate(const char *path)
+static void freeExplorerChildren(EditorExplorerNode *node)
 {
-  EditorExplorerNode *node = malloc_s(sizeof(EditorExplorerNode));
+  // A listing still on its way is dropped when it's merged
+  if (node->listing)
+    node->listing->node = NULL;
+  unwatchNode(node);
 
-  int len        = strlen(path);
-  node->filename = malloc_s(len + 1);
-  snprintf(node->filename, len + 1, "%s", path);
+  for (size_t i = 0; i < node->dir.count; i++)
+  {
+    freeExplorerChildren(node->dir.nodes[i]);
+  }
 
-  node->is_directory = (getFileType(path) == FT_DIR);
-  node->is_open      = false;
-  node->loaded       = false;
-  node->depth        = 0;
-  node->dir.count    = 0;
-  node->dir.nodes    = NULL;
-  node->file.count   = 0;
-  node->file.nodes   = NULL;
+  free(node->dir.nodes);
+  free(node->file.nodes);
+  while (node->blocks)
+  {
+    EditorExplorerBlock *next = node->blocks->next;
+    free(node->blocks->names);
+    free(node->blocks);
+    node->blocks = next;
+  }
+}
 
-  return node;
+static void editorExplorerFreeNode(EditorExplorerNode *node)
+{
+  if (!node)
+    return;
+
+  freeExplorerChildren(node);
+  free(node->filename);
+  free(node);
 }
 
-void editorExplorerLoadNode(EditorExplorerNode *node)
+/**
+ * releaseChild - Free a child of a directory whose entry is gone
+ * @node: The directory
+ * @child: The child, its block is freed with its last node
+ */
+static void releaseChild(EditorExplorerNode *node, EditorExplorerNode *child)
 {
-  if (!node->is_directory)
+  freeExplorerChildren(child);
+
+  EditorExplorerBlock **link = &node->blocks;
+  while (*link && (child < (*link)->nodes || child >= (*link)->nodes + (*link)->count))
+  {
+    link = &(*link)->next;
+  }
+
+  EditorExplorerBlock *block = *link;
+  if (!block || --block->live)
     return;
+  *link = block->next;
+  free(block->names);
+  free(block);
+}
 
-  DirIter iter = dirFindFirst(node->filename);
+static int compareNames(const void *a, const void *b)
+{
+  return strcmp(*(char *const *) a, *(char *const *) b);
+}
+
+static char **sortNames(const abuf *names, const size_t *offsets, size_t count)
+{
+  char **sorted = malloc_s(count * sizeof(char *));
+  for (size_t i = 0; i < count; i++)
+  {
+    sorted[i] = &names->buf[offsets[i]];
+  }
+  qsort(sorted, count, sizeof(char *), compareNames);
+  return sorted;
+}
+
+/**
+ * listDirectory - Read the entries of a directory
+ * @listing: The listing to fill, only @path and @show_hidden are read
+ *
+ * Safe to call off the UI thread. The entry type comes with the name, an
+ * entry is only stat'ed when the file system doesn't tell.
+ */
+static void listDirectory(ExplorerListing *listing)
+{
+  DirIter iter = dirFindFirst(listing->path);
   if (iter.error)
+  {
+    listing->error = true;
     return;
+  }
 
+  VECTOR(size_t) dirs  = {0};
+  VECTOR(size_t) files = {0};
+  size_t prefix        = strlen(listing->path);
   do
   {
     const char *filename = dirGetName(&iter);
-    if (CONVAR_GETINT(ex_show_hidden) == 0 && filename[0] == '.')
+    if (!listing->show_hidden && filename[0] == '.')
       continue;
     if (strcmp(filename, ".") == 0 || strcmp(filename, "..") == 0)
       continue;
 
-    char entry_path[EDITOR_PATH_MAX];
-    snprintf(entry_path, sizeof(entry_path), PATH_CAT("%s", "%s"), node->filename, filename);
+    if (dirIsDir(&iter))
+      vector_push(dirs, listing->names.len);
+    else
+      vector_push(files, listing->names.len);
+    abufAppendN(&listing->names, listing->path, prefix);
+    abufAppendStr(&listing->names, DIR_SEP);
+    abufAppendN(&listing->names, filename, strlen(filename) + 1);
+  } while (dirNext(&iter));
+  dirClose(&iter);
+
+  listing->dirs       = sortNames(&listing->names, dirs.data, dirs.size);
+  listing->dir_count  = dirs.size;
+  listing->files      = sortNames(&listing->names, files.data, files.size);
+  listing->file_count = files.size;
+  free(dirs.data);
+  free(files.data);
+}
 
-    EditorExplorerNode *child = editorExplorerCreate(entry_path);
-    if (!child)
-      continue;
+static void freeListing(ExplorerListing *listing)
+{
+  free(listing->path);
+  free(listing->dirs);
+  free(listing->files);
+  abufFree(&listing->names);
+  free(listing);
+}
 
-    child->depth = node->depth + 1;
+/**
+ * matchChildren - Pair the children of a directory with a new listing
+ * @node: The directory
+ * @old: Children before, sorted
+ * @old_count: Number of @old
+ * @names: Sorted paths of the listing
+ * @count: Number of @names
+ * @added: Incremented for each entry without a node
+ *
+ * Children that are gone are freed.
+ *
+ * Returns: Nodes for @names, NULL for the new entries
+ */
+static EditorExplorerNode **matchChildren(EditorExplorerNode *node, EditorExplorerNode **old,
+                                          size_t old_count, char **names, size_t count,
+                                          size_t *added)
+{
+  EditorExplorerNode **matched = malloc_s(count * sizeof(EditorExplorerNode *));
 
-    if (child->is_directory)
+  size_t i = 0;
+  size_t j = 0;
+  while (i < old_count || j < count)
+  {
+    int cmp = (i == old_count) ? 1 : (j == count) ? -1 : strcmp(old[i]->filename, names[j]);
+    if (cmp < 0)
     {
-      insertExplorerNode(child, &node->dir);
+      releaseChild(node, old[i++]);
+    }
+    else if (cmp > 0)
+    {
+      matched[j++] = NULL;
+      (*added)++;
     }
     else
     {
-      insertExplorerNode(child, &node->file);
+      matched[j++] = old[i++];
     }
-  } while (dirNext(&iter));
-  dirClose(&iter);
-
-  node->loaded = true;
+  }
+  return matched;
 }
 
-static void flattenNode(EditorExplorerNode *node)
+/**
+ * applyListing - Set the children of a directory from its listing
+ * @node: The directory
+ * @listing: The listing, the paths of new entries are copied to @node
+ *
+ * The first listing makes every node. Later listings keep the nodes of the
+ * entries that are still there, so open subdirectories stay open.
+ */
+static void applyListing(EditorExplorerNode *node, ExplorerListing *listing)
 {
-  if (node != gEditor.explorer.node)
-    vector_push(gEditor.explorer.flatten, node);
+  size_t               added = 0;
+  EditorExplorerNode **dirs  = matchChildren(node, node->dir.nodes, node->dir.count,
+                                             listing->dirs, listing->dir_count, &added);
+  EditorExplorerNode **files = matchChildren(node, node->file.nodes, node->file.count,
+                                             listing->files, listing->file_count, &added);
+  size_t               total = listing->dir_count + listing->file_count;
+
+  // New entries get their nodes and paths from one block
+  EditorExplorerBlock *block = NULL;
+  size_t               used  = 0;
+  if (added)
+  {
+    size_t names_size = 0;
+    for (size_t i = 0; i < listing->dir_count; i++)
+    {
+      if (!dirs[i])
+        names_size += strlen(listing->dirs[i]) + 1;
+    }
+    for (size_t i = 0; i < listing->file_count; i++)
+    {
+      if (!files[i])
+        names_size += strlen(listing->files[i]) + 1;
+    }
+
+    block        = malloc_s(sizeof(EditorExplorerBlock) + added * sizeof(EditorExplorerNode));
+    block->names = malloc_s(names_size);
+    block->count = added;
+    block->live  = added;
+    block->next  = node->blocks;
+    node->blocks = block;
+  }
+
+  size_t names_used = 0;
+  for (size_t i = 0; i < total; i++)
+  {
+    bool                 is_dir = i < listing->dir_count;
+    size_t               at     = is_dir ? i : i - listing->dir_count;
+    EditorExplorerNode **slot   = is_dir ? &dirs[at] : &files[at];
+    if (*slot)
+      continue;
 
+    const char *path = is_dir ? listing->dirs[at] : listing->files[at];
+    size_t      len  = strlen(path) + 1;
+    char       *name = &block->names[names_used];
+    memcpy(name, path, len);
+    names_used += len;
+
+    EditorExplorerNode *child = &block->nodes[used++];
+    initExplorerNode(child, name, is_dir);
+    child->depth  = node->depth + 1;
+    child->parent = node;
+    *slot         = child;
+  }
+
+  free(node->dir.nodes);
+  free(node->file.nodes);
+  node->dir.nodes  = dirs;
+  node->dir.count  = listing->dir_count;
+  node->file.nodes = files;
+  node->file.count = listing->file_count;
+  node->loaded     = true;
+}
+
+/**
+ * countVisible - Count the entries shown for a subtree
+ * @node: Root of the subtree
+ *
+ * Sets the visible count of every open node of the subtree.
+ *
+ * Returns: The visible count of @node
+ */
+static size_t countVisible(EditorExplorerNode *node)
+{
+  node->visible = 1;
   if (node->is_directory && node->is_open)
   {
-    if (!node->loaded)
-      editorExplorerLoadNode(node);
+    for (size_t i = 0; i < node->dir.count; i++)
+    {
+      node->visible += countVisible(node->dir.nodes[i]);
+    }
+    node->visible += node->file.count;
+  }
+  return node->visible;
+}
+
+/**
+ * flattenNode - Write the entries shown under an open directory
+ * @node: The directory
+ * @out: Room for node->visible - 1 entries
+ *
+ * Returns: Pointer after the last written entry
+ */
+static EditorExplorerNode **flattenNode(EditorExplorerNode *node, EditorExplorerNode **out)
+{
+  if (!node->is_directory || !node->is_open)
+    return out;
 
+  for (size_t i = 0; i < node->dir.count; i++)
+  {
+    *out++ = node->dir.nodes[i];
+    out    = flattenNode(node->dir.nodes[i], out);
+  }
+
+  for (size_t i = 0; i < node->file.count; i++)
+  {
+    *out++ = node->file.nodes[i];
+  }
+  return out;
+}
+
+static int findEntry(const EditorExplorerNode *node)
+{
+  for (size_t i = 0; i < gEditor.explorer.flatten.size; i++)
+  {
+    if (gEditor.explorer.flatten.data[i] == node)
+      return i;
+  }
+  return -1;
+}
+
+/**
+ * rebuildList - Write the whole list again from the visible counts
+ *
+ * The selection stays on the same entry, or on the one at its place when
+ * the entry is gone.
+ */
+static void rebuildList(void)
+{
+  EditorExplorer     *explorer = &gEditor.explorer;
+  EditorExplorerNode *selected = NULL;
+  if (explorer->selected_index >= 0 && explorer->selected_index < (int) explorer->flatten.size)
+    selected = explorer->flatten.data[explorer->selected_index];
+
+  size_t count = explorer->node->visible - 1;
+  free(explorer->flatten.data);
+  explorer->flatten.data     = malloc_s((count ? count : 1) * sizeof(EditorExplorerNode *));
+  explorer->flatten.size     = count;
+  explorer->flatten.capacity = count;
+  flattenNode(explorer->node, explorer->flatten.data);
+
+  int index = selected ? findEntry(selected) : -1;
+  if (index >= 0)
+    explorer->selected_index = index;
+  else if (explorer->selected_index >= (int) count)
+    explorer->selected_index = count ? count - 1 : 0;
+}
+
+/**
+ * recountVisible - Count the entries of a node again after it changed
+ * @node: The node, opened, closed or with new children
+ * @old_visible: Set to the visible count before
+ *
+ * Children keep their counts while hidden, only @node and its parents
+ * change.
+ *
+ * Returns: Whether the entries of @node are in the list
+ */
+static bool recountVisible(EditorExplorerNode *node, size_t *old_visible)
+{
+  *old_visible  = node->visible;
+  node->visible = 1;
+  if (node->is_open)
+  {
     for (size_t i = 0; i < node->dir.count; i++)
     {
-      flattenNode(node->dir.nodes[i]);
+      node->visible += node->dir.nodes[i]->visible;
+    }
+    node->visible += node->file.count;
+  }
+
+  // A closed parent counts as one entry whatever its children hold
+  for (EditorExplorerNode *parent = node->parent; parent; parent = parent->parent)
+  {
+    if (!parent->is_open)
+      return false;
+    parent->visible = parent->visible - *old_visible + node->visible;
+  }
+  return true;
+}
+
+/**
+ * updateVisible - Splice the entries of a node in or out of the list
+ * @node: The node, opened, closed or loaded for the first time
+ * @index: Index of @node in the list, -1 to look it up
+ *
+ * The selection stays on the same entry.
+ */
+static void updateVisible(EditorExplorerNode *node, int index)
+{
+  EditorExplorer *explorer = &gEditor.explorer;
+
+  size_t old_visible;
+  if (!recountVisible(node, &old_visible) || node->visible == old_visible)
+    return;
+
+  // The root isn't in the list, its entries start at 0
+  if (index < 0 && node != explorer->node)
+  {
+    index = findEntry(node);
+    if (index < 0)
+      return;
+  }
+
+  size_t               size  = explorer->flatten.size;
+  size_t               after = size - index - 1;
+  EditorExplorerNode **start = &explorer->flatten.data[index + 1];
+  if (node->visible > old_visible)
+  {
+    size_t added = node->visible - old_visible;
+    if (size + added > explorer->flatten.capacity)
+    {
+      size_t capacity            = size + added;
+      explorer->flatten.data     = realloc_s(explorer->flatten.data,
+                                             capacity * sizeof(EditorExplorerNode *));
+      explorer->flatten.capacity = capacity;
+      start                      = &explorer->flatten.data[index + 1];
     }
+    memmove(start + added, start, after * sizeof(EditorExplorerNode *));
+    flattenNode(node, start);
+    explorer->flatten.size += added;
 
-    for (size_t i = 0; i < node->file.count; i++)
+    if (explorer->selected_index > index && explorer->selected_index < (int) size)
+      explorer->selected_index += added;
+  }
+  else
+  {
+    size_t removed = old_visible - node->visible;
+    memmove(start, start + removed, (after - removed) * sizeof(EditorExplorerNode *));
+    explorer->flatten.size -= removed;
+
+    if (explorer->selected_index > index + (int) removed)
+      explorer->selected_index -= removed;
+    else if (explorer->selected_index > index)
+      explorer->selected_index = index;
+  }
+}
+
+static void scanThread(void *arg)
+{
+  UNUSED(arg);
+
+  mutexLock(&scan.mutex);
+  while (true)
+  {
+    while (!scan.jobs)
     {
-      flattenNode(node->file.nodes[i]);
+      condWait(&scan.cond, &scan.mutex);
     }
+
+    ExplorerListing *listing = scan.jobs;
+    scan.jobs                = listing->next;
+    mutexUnlock(&scan.mutex);
+
+    listDirectory(listing);
+
+    mutexLock(&scan.mutex);
+    listing->next = scan.done;
+    scan.done     = listing;
+    wakeConsole();
   }
 }
 
+static void startScan(void)
+{
+  if (scan.started)
+    return;
+
+  scan.started = true;
+  mutexInit(&scan.mutex);
+  condInit(&scan.cond);
+  for (int i = 0; i < EXPLORER_SCAN_THREADS; i++)
+  {
+    scan.threads += threadStart(scanThread, NULL);
+  }
+}
+
+/**
+ * queueListing - List a directory off the UI thread
+ * @node: The directory
+ * @prefetch: The directory isn't open, list it after the open ones
+ *
+ * The node is loading until editorExplorerPoll merges the listing. Without
+ * scan threads the directory is listed right away, and merged by the next
+ * poll all the same. Must hold the mutex.
+ */
+static void queueListing(EditorExplorerNode *node, bool prefetch)
+{
+  ExplorerListing *listing = calloc_s(1, sizeof(ExplorerListing));
+  listing->node            = node;
+  listing->generation      = scan.generation;
+  listing->prefetch        = prefetch;
+  listing->show_hidden     = CONVAR_GETINT(ex_show_hidden);
+
+  size_t len    = strlen(node->filename);
+  listing->path = malloc_s(len + 1);
+  memcpy(listing->path, node->filename, len + 1);
+
+  node->loading = true;
+  node->listing = listing;
+
+  if (scan.threads == 0)
+  {
+    listDirectory(listing);
+    listing->next = scan.done;
+    scan.done     = listing;
+    wakeConsole();
+    return;
+  }
+
+  if (prefetch)
+  {
+    listing->next = NULL;
+    if (scan.jobs)
+      scan.jobs_tail->next = listing;
+    else
+      scan.jobs = listing;
+    scan.jobs_tail = listing;
+  }
+  else
+  {
+    listing->next = scan.jobs;
+    if (!scan.jobs)
+      scan.jobs_tail = listing;
+    scan.jobs = listing;
+  }
+  condSignal(&scan.cond);
+}
+
+/**
+ * requestListing - List a directory that isn't loaded yet
+ * @node: The directory
+ * @prefetch: The directory isn't open, list it after the open ones
+ *
+ * The directory is watched from here on, changes made while it's listed
+ * list it again.
+ */
+static void requestListing(EditorExplorerNode *node, bool prefetch)
+{
+  if (!node->is_directory || node->loaded)
+    return;
+
+  startScan();
+  mutexLock(&scan.mutex);
+
+  if (!node->loading)
+  {
+    if (!node->watch)
+      watchNode(node);
+    queueListing(node, prefetch);
+  }
+  else if (!prefetch)
+  {
+    // A directory opened while its prefetch waits moves to the front
+    ExplorerListing *prev = NULL;
+    ExplorerListing *listing;
+    for (listing = scan.jobs; listing && listing != node->listing; listing = listing->next)
+    {
+      prev = listing;
+    }
+
+    if (listing)
+    {
+      if (prev)
+        prev->next = listing->next;
+      else
+        scan.jobs = listing->next;
+      if (scan.jobs_tail == listing)
+        scan.jobs_tail = prev;
+
+      listing->next     = scan.jobs;
+      listing->prefetch = false;
+      if (!scan.jobs)
+        scan.jobs_tail = listing;
+      scan.jobs = listing;
+    }
+  }
+
+  mutexUnlock(&scan.mutex);
+}
+
+/**
+ * refreshListing - List a loaded directory again after it changed on disk
+ * @node: The directory
+ */
+static void refreshListing(EditorExplorerNode *node)
+{
+  if (node->loading)
+  {
+    node->stale = true;
+    return;
+  }
+
+  startScan();
+  mutexLock(&scan.mutex);
+  queueListing(node, false);
+  mutexUnlock(&scan.mutex);
+}
+
+static void mergeListing(ExplorerListing *listing)
+{
+  EditorExplorerNode *node = listing->node;
+  if (!node)
+    return;
+
+  bool first    = !node->loaded;
+  node->loading = false;
+  node->listing = NULL;
+
+  if (!listing->error)
+  {
+    applyListing(node, listing);
+    if (first)
+    {
+      updateVisible(node, -1);
+    }
+    else
+    {
+      // Entries that are gone may be in the list even when the count is the same
+      size_t old_visible;
+      if (recountVisible(node, &old_visible) && node->is_open)
+        rebuildList();
+    }
+
+    if (first && !listing->prefetch)
+    {
+      for (size_t i = 0; i < node->dir.count && i < EXPLORER_PREFETCH_MAX; i++)
+      {
+        requestListing(node->dir.nodes[i], true);
+      }
+    }
+  }
+
+  if (node->stale)
+  {
+    node->stale = false;
+    refreshListing(node);
+  }
+}
+
+/**
+ * dropListings - Forget the listings of the explorer tree
+ *
+ * Must be called after the tree is freed. Listings in progress finish and
+ * are dropped when they are merged.
+ */
+static void dropListings(void)
+{
+  if (!scan.started)
+    return;
+
+  mutexLock(&scan.mutex);
+  scan.generation++;
+  ExplorerListing *jobs = scan.jobs;
+  ExplorerListing *done = scan.done;
+  scan.jobs             = NULL;
+  scan.jobs_tail        = NULL;
+  scan.done             = NULL;
+  mutexUnlock(&scan.mutex);
+
+  while (jobs)
+  {
+    ExplorerListing *next = jobs->next;
+    freeListing(jobs);
+    jobs = next;
+  }
+  while (done)
+  {
+    ExplorerListing *next = done->next;
+    freeListing(done);
+    done = next;
+  }
+}
+
+void editorExplorerPoll(void)
+{
+  if (!scan.started)
+    return;
+
+  mutexLock(&scan.mutex);
+  ExplorerListing *done = scan.done;
+  scan.done             = NULL;
+  mutexUnlock(&scan.mutex);
+
+  bool merged = false;
+  while (done)
+  {
+    ExplorerListing *next = done->next;
+    if (done->generation == scan.generation)
+    {
+      mergeListing(done);
+      merged = true;
+    }
+    freeListing(done);
+    done = next;
+  }
+
+  if (merged)
+    editorRefreshScreen();
+}
+
+/**
+ * checkFileOnDisk - Flag an open file that changed on disk
+ * @file: The file
+ *
+ * Returns: Whether the file was newly flagged
+ */
+static bool checkFileOnDisk(EditorFile *file)
+{
+  FileInfo info = getFileInfo(file->filename);
+
+  // A file replaced by a rename is another file, watch the path again
+  if (info.error || !areFilesEqual(info, file->file_info))
+  {
+    watchRemove(file->watch);
+    file->watch = watchAdd(file->filename, false);
+  }
+
+  if (file->disk_changed)
+    return false;
+
+  if (!info.error && areFilesEqual(info, file->file_info) &&
+      getFileModTime(info) == getFileModTime(file->file_info) &&
+      getFileSize(info) == getFileSize(file->file_info))
+    return false;
+
+  file->disk_changed = true;
+  editorMsg("\"%s\" changed on disk. Use \"reload\" to read it again.",
+            getBaseName(file->filename));
+  return true;
+}
+
+void editorWatchEvents(const int *watches, int count)
+{
+  bool flagged = false;
+  for (int i = 0; i < count; i++)
+  {
+    // Listing again only queues, the tree doesn't change here
+    for (size_t j = 0; j < watched_nodes.size; j++)
+    {
+      if (watched_nodes.data[j]->watch == watches[i])
+        refreshListing(watched_nodes.data[j]);
+    }
+
+    for (int j = 0; j < gEditor.file_count; j++)
+    {
+      if (gEditor.files[j].watch == watches[i])
+        flagged = checkFileOnDisk(&gEditor.files[j]) || flagged;
+    }
+  }
+
+  if (flagged)
+    editorRefreshScreen();
+}
+
 void editorExplorerRefresh(void)
 {
-  gEditor.explorer.flatten.size     = 0;
-  gEditor.explorer.flatten.capacity = 0;
-  free(gEditor.explorer.flatten.data);
-  flattenNode(gEditor.explorer.node);
-  vector_shrink(gEditor.explorer.flatten);
+  countVisible(gEditor.explorer.node);
+  rebuildList();
+
+  if (gEditor.explorer.node->is_open)
+    requestListing(gEditor.explorer.node, false);
+}
+
+void editorExplorerReload(void)
+{
+  editorExplorerFreeNode(gEditor.explorer.node);
+  dropListings();
+
+  gEditor.explorer.node           = editorExplorerCreate(".");
+  gEditor.explorer.node->is_open  = true;
+  gEditor.explorer.offset         = 0;
+  gEditor.explorer.selected_index = 0;
+  editorExplorerRefresh();
+}
+
+void editorExplorerToggle(int index)
+{
+  EditorExplorerNode *node = gEditor.explorer.flatten.data[index];
+  if (!node->is_directory)
+    return;
+
+  node->is_open ^= 1;
+  updateVisible(node, index);
+  if (node->is_open)
+    requestListing(node, false);
 }
 
 void editorExplorerFree(void)
 {
   editorExplorerFreeNode(gEditor.explorer.node);
+  dropListings();
   free(gEditor.explorer.flatten.data);
+  free(watched_nodes.data);
 }
@@ -11,14 +11,20 @@ typedef struct EditorExplorerNodeData
 
 typedef struct EditorExplorerNode
 {
-  char                  *filename;
-  bool                   is_directory;
-  bool                   is_open;  // Is directory open in the explorer
-  bool                   loaded;   // Is directory loaded
-  int                    depth;
-  size_t                 dir_count;
-  EditorExplorerNodeData dir;
-  EditorExplorerNodeData file;
+  char                       *filename;
+  bool                        is_directory;
+  bool                        is_open;  // Is directory open in the explorer
+  bool                        loaded;   // Is directory loaded
+  bool                        loading;  // Listing of the directory is on its way
+  bool                        stale;    // Directory changed while it was listed
+  int                         depth;
+  int                         watch;    // File system watch of the directory, 0 if none
+  size_t                      visible;  // Entries shown for the subtree, the node included
+  struct EditorExplorerNode  *parent;
+  struct EditorExplorerBlock *blocks;   // Nodes and paths of the loaded entries
+  struct ExplorerListing     *listing;  // Listing on its way
+  EditorExplorerNodeData      dir;
+  EditorExplorerNodeData      file;
 } EditorExplorerNode;
 
 typedef struct EditorExplorer
@@ -37,9 +43,35 @@ bool editorOpen(EditorFile *file, const char *filename);
 bool editorSave(EditorFile *file, int save_as);
 void editorOpenFilePrompt(void);
 
+/**
+ * editorOpenPath - Open a file in a new tab and switch to it
+ * @path: Path of the file
+ */
+void editorOpenPath(const char *path);
+
 EditorExplorerNode *editorExplorerCreate(const char *path);
-void                editorExplorerLoadNode(EditorExplorerNode *node);
 void                editorExplorerRefresh(void);
+void                editorExplorerReload(void);
+void                editorExplorerToggle(int index);
+void                editorExplorerPoll(void);
 void                editorExplorerFree(void);
 
+/**
+ * editorWatchEvents - Handle changes reported by the file system watches
+ * @watches: Watches that had events, see watchAdd()
+ * @count: Number of @watches
+ *
+ * Explorer directories are listed again, open files that changed are
+ * flagged for the "reload" command.
+ */
+void editorWatchEvents(const int *watches, int count);
+
+/**
+ * editorReload - Read a file again from disk
+ * @file: The file, its undo history is dropped
+ *
+ * Returns: Whether the file could be read
+ */
+bool editorReload(EditorFile *file);
+
 #endif
@@ -0,0 +1,1275 @@
+#include "finder.h"
+
+#include "editor.h"
+#include "file_io.h"
+#include "output.h"
+#include "prompt.h"
+#include "terminal.h"
+
+#include <inttypes.h>
+
+// Threads that walk directories, next to the thread that builds the index
+#define FINDER_WALK_THREADS 4
+
+// Paths matched by one thread at a time
+#define FINDER_MATCH_PART 16384
+
+// Longest query that is matched, the rest is ignored
+#define FINDER_QUERY_MAX 256
+
+// First line of the cache file, changes with its format
+#define FINDER_CACHE_MAGIC "lexfinder 1"
+
+// Directories that are never walked
+static const char *const ignored_dirs[] = {".git", ".hg", ".svn"};
+
+/**
+ * struct FinderDir - A directory of the file index
+ * @path: Path from the root, "" for the root itself
+ * @mtime: Modification time when it was listed
+ * @files: Sorted names of the files, each followed by a NUL
+ * @dirs: Sorted names of the subdirectories, each followed by a NUL
+ * @dir_count: Number of subdirectories
+ * @children: Index of each subdirectory in the index, -1 if it's missing
+ * @listed: Listed by this build, not taken from the cache
+ *
+ * The modification time of a directory changes when an entry is added,
+ * removed or renamed, so a directory with the same time is taken as is.
+ */
+typedef struct FinderDir
+{
+  char    *path;
+  int64_t  mtime;
+  abuf     files;
+  abuf     dirs;
+  size_t   dir_count;
+  int     *children;
+  bool     listed;
+} FinderDir;
+
+/**
+ * struct FinderIndex - Files under a root directory
+ * @root: Full path of the root
+ * @dirs: Directories sorted by path
+ * @dir_count: Number of @dirs
+ * @paths: Paths of the files from the root, each followed by a NUL
+ * @lower: @paths in lower case, the one the matcher reads
+ * @starts: Offset of each path in @paths
+ * @bases: Offset of the file name in each path
+ * @masks: Characters in each path, see charMask()
+ * @count: Number of files
+ */
+typedef struct FinderIndex
+{
+  char       *root;
+  FinderDir **dirs;
+  size_t      dir_count;
+  char       *paths;
+  char       *lower;
+  uint32_t   *starts;
+  uint16_t   *bases;
+  uint64_t   *masks;
+  size_t      count;
+} FinderIndex;
+
+/**
+ * struct FinderJob - A directory waiting to be walked
+ * @path: Path from the root
+ * @cached: The directory in the index the build starts from, NULL if new
+ * @next: Next job in the queue
+ */
+typedef struct FinderJob
+{
+  char             *path;
+  const FinderDir  *cached;
+  struct FinderJob *next;
+} FinderJob;
+
+/**
+ * struct FinderBest - Best matches of a query
+ * @ids: Paths, best first
+ * @scores: Score of each path
+ * @count: Number of @ids
+ */
+typedef struct FinderBest
+{
+  uint32_t ids[EDITOR_FINDER_MATCH_MAX];
+  int      scores[EDITOR_FINDER_MATCH_MAX];
+  int      count;
+} FinderBest;
+
+/**
+ * struct FinderMatch - A part of the candidates matched by one thread
+ * @begin: First candidate
+ * @end: End of the candidates
+ * @kept: Candidates that matched, moved to the start of the part
+ * @best: Best matches of the part
+ */
+typedef struct FinderMatch
+{
+  size_t     begin;
+  size_t     end;
+  size_t     kept;
+  FinderBest best;
+} FinderMatch;
+
+/**
+ * Index builds, behind the mutex. One build runs at a time on the index
+ * thread, the walk threads and the index thread walk its directories.
+ */
+static struct
+{
+  Mutex        mutex;
+  Cond         work;     // Jobs were queued
+  Cond         idle;     // Jobs were queued or the walk is done
+  Cond         request;  // A build was requested
+  bool         started;
+  bool         thread;  // The index thread runs
+  bool         building;
+  bool         requested;
+  bool         again;  // Build again once the current build is taken
+  char        *root;
+  FinderIndex *cache;  // Index the build starts from, read only while building
+  FinderJob   *jobs;
+  size_t       pending;  // Jobs queued or being walked
+  size_t       found;    // Files found by the current build
+  FinderIndex *done;
+  VECTOR(FinderDir *) results;
+
+  // Parts of the running query, the walk threads take them before jobs
+  Cond         matched;  // The last part of the query is done
+  FinderMatch *matches;
+  size_t       match_count;
+  size_t       match_next;
+  size_t       match_left;
+} build;
+
+/**
+ * The running query, set before its parts are queued and read only until
+ * they are done
+ */
+static struct
+{
+  const FinderIndex *index;
+  uint32_t          *candidates;  // Candidates, NULL for every path
+  uint32_t          *kept;        // Where the parts move their matches
+  char               text[FINDER_QUERY_MAX];
+  int                len;
+  uint64_t           mask;
+} query;
+
+/**
+ * State of the prompt, only used on the UI thread
+ */
+static struct
+{
+  FinderIndex     *index;
+  char            *root;  // Working directory when the prompt opened
+  char             query[FINDER_QUERY_MAX + 1];
+  bool             narrowed;  // @candidates hold the matches of @query
+  VECTOR(uint32_t) candidates;
+  EditorFinderView view;
+} finder;
+
+static char *copyString(const char *s)
+{
+  size_t len  = strlen(s) + 1;
+  char  *copy = malloc_s(len);
+  memcpy(copy, s, len);
+  return copy;
+}
+
+static char *joinPath(const char *dir, const char *name)
+{
+  size_t dir_len  = strlen(dir);
+  size_t name_len = strlen(name);
+  size_t sep_len  = dir_len ? strlen(DIR_SEP) : 0;
+  char  *path     = malloc_s(dir_len + sep_len + name_len + 1);
+  memcpy(path, dir, dir_len);
+  memcpy(path + dir_len, DIR_SEP, sep_len);
+  memcpy(path + dir_len + sep_len, name, name_len + 1);
+  return path;
+}
+
+static void freeDir(FinderDir *dir)
+{
+  free(dir->path);
+  abufFree(&dir->files);
+  abufFree(&dir->dirs);
+  free(dir->children);
+  free(dir);
+}
+
+static void freeIndex(FinderIndex *index)
+{
+  if (!index)
+    return;
+
+  for (size_t i = 0; i < index->dir_count; i++)
+  {
+    freeDir(index->dirs[i]);
+  }
+  free(index->dirs);
+  free(index->root);
+  free(index->paths);
+  free(index->lower);
+  free(index->starts);
+  free(index->bases);
+  free(index->masks);
+  free(index);
+}
+
+// ========== Building the Index ==========
+
+static int comparePaths(const void *a, const void *b)
+{
+  return strcmp((*(FinderDir *const *) a)->path, (*(FinderDir *const *) b)->path);
+}
+
+static int compareNames(const void *a, const void *b)
+{
+  return strcmp(*(char *const *) a, *(char *const *) b);
+}
+
+static int findDirIndex(const FinderIndex *index, const char *path)
+{
+  FinderDir   key   = {.path = (char *) path};
+  FinderDir  *ptr   = &key;
+  FinderDir **found = bsearch(&ptr, index->dirs, index->dir_count, sizeof(FinderDir *),
+                              comparePaths);
+  return found ? (int) (found - index->dirs) : -1;
+}
+
+static FinderDir *findDir(const FinderIndex *index, const char *path)
+{
+  int at = findDirIndex(index, path);
+  return (at < 0) ? NULL : index->dirs[at];
+}
+
+/**
+ * linkDirs - Sort the directories of an index and link them to their parents
+ * @index: The index
+ */
+static void linkDirs(FinderIndex *index)
+{
+  qsort(index->dirs, index->dir_count, sizeof(FinderDir *), comparePaths);
+
+  for (size_t i = 0; i < index->dir_count; i++)
+  {
+    FinderDir  *dir  = index->dirs[i];
+    const char *name = dir->dirs.buf;
+    dir->children    = malloc_s((dir->dir_count ? dir->dir_count : 1) * sizeof(int));
+    for (size_t j = 0; j < dir->dir_count; j++)
+    {
+      char *path       = joinPath(dir->path, name);
+      dir->children[j] = findDirIndex(index, path);
+      free(path);
+      name += strlen(name) + 1;
+    }
+  }
+}
+
+/**
+ * charMask - Get the bit of a character in the path masks
+ * @c: The character in lower case
+ *
+ * A path can only match a query whose mask is a subset of its own.
+ */
+static inline uint64_t charMask(uint8_t c)
+{
+  if (c >= 'a' && c <= 'z')
+    return 1ull << (c - 'a');
+  if (c >= '0' && c <= '9')
+    return 1ull << (26 + c - '0');
+  return 1ull << (36 + c % 28);
+}
+
+static inline uint8_t lowerChar(uint8_t c)
+{
+  return (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c;
+}
+
+/**
+ * flattenIndex - Write the paths of all files of an index
+ * @index: The index, with its directories linked
+ */
+static void flattenIndex(FinderIndex *index)
+{
+  size_t count = 0;
+  size_t bytes = 0;
+  for (size_t i = 0; i < index->dir_count; i++)
+  {
+    const FinderDir *dir     = index->dirs[i];
+    size_t           dir_len = strlen(dir->path);
+    size_t           prefix  = dir_len ? dir_len + strlen(DIR_SEP) : 0;
+    for (size_t at = 0; at < dir->files.len; at += strlen(&dir->files.buf[at]) + 1)
+    {
+      count++;
+      bytes += prefix;
+    }
+    bytes += dir->files.len;
+  }
+
+  index->paths  = malloc_s(bytes ? bytes : 1);
+  index->lower  = malloc_s(bytes ? bytes : 1);
+  index->starts = malloc_s((count ? count : 1) * sizeof(uint32_t));
+  index->bases  = malloc_s((count ? count : 1) * sizeof(uint16_t));
+  index->masks  = malloc_s((count ? count : 1) * sizeof(uint64_t));
+  index->count  = count;
+
+  size_t n   = 0;
+  char  *out = index->paths;
+  for (size_t i = 0; i < index->dir_count; i++)
+  {
+    const FinderDir *dir     = index->dirs[i];
+    size_t           dir_len = strlen(dir->path);
+    for (size_t at = 0; at < dir->files.len;)
+    {
+      const char *name     = &dir->files.buf[at];
+      size_t      name_len = strlen(name);
+      at += name_len + 1;
+
+      index->starts[n] = out - index->paths;
+      if (dir_len)
+      {
+        memcpy(out, dir->path, dir_len);
+        memcpy(out + dir_len, DIR_SEP, strlen(DIR_SEP));
+        out += dir_len + strlen(DIR_SEP);
+      }
+      index->bases[n] = (out - index->paths) - index->starts[n];
+      memcpy(out, name, name_len + 1);
+      out += name_len + 1;
+      n++;
+    }
+  }
+
+  for (size_t i = 0; i < count; i++)
+  {
+    uint64_t mask  = 0;
+    char    *path  = &index->paths[index->starts[i]];
+    char    *lower = &index->lower[index->starts[i]];
+    size_t   j     = 0;
+    for (; path[j]; j++)
+    {
+      lower[j] = lowerChar(path[j]);
+      mask |= charMask(lower[j]);
+    }
+    lower[j]        = '\0';
+    index->masks[i] = mask;
+  }
+}
+
+static uint32_t hashRoot(const char *root)
+{
+  uint32_t hash = 2166136261u;
+  for (; *root; root++)
+  {
+    hash ^= (uint8_t) *root;
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+static void cachePath(const char *root, char *path, size_t size)
+{
+  snprintf(path, size, PATH_CAT("%s", CONF_DIR, "finder-%08x.cache"), getenv(ENV_HOME),
+           hashRoot(root));
+}
+
+/**
+ * loadCache - Read the index of a root saved by an earlier build
+ * @root: Full path of the root
+ *
+ * Returns: The directories of the index linked without their paths, NULL
+ * if there is no cache
+ */
+static FinderIndex *loadCache(const char *root)
+{
+  char path[EDITOR_PATH_MAX];
+  cachePath(root, path, sizeof(path));
+  FILE *fp = openFile(path, "rb");
+  if (!fp)
+    return NULL;
+
+  char   *line = NULL;
+  size_t  n    = 0;
+  int64_t len;
+
+  FinderIndex *index = NULL;
+  VECTOR(FinderDir *) dirs = {0};
+  FinderDir *dir           = NULL;
+  int        line_no       = 0;
+  while ((len = getLine(&line, &n, fp)) != -1)
+  {
+    if (len > 0 && line[len - 1] == '\n')
+      line[--len] = '\0';
+
+    // The cache of another root with the same hash is ignored
+    line_no++;
+    if ((line_no == 1 && strcmp(line, FINDER_CACHE_MAGIC) != 0) ||
+        (line_no == 2 && strcmp(line, root) != 0))
+      break;
+    if (line_no <= 2)
+      continue;
+
+    if (len < 2 || line[1] != ' ')
+      continue;
+
+    if (line[0] == 'd')
+    {
+      char   *end;
+      int64_t mtime = strtoll(&line[2], &end, 10);
+      if (*end != ' ')
+        continue;
+      dir        = calloc_s(1, sizeof(FinderDir));
+      dir->path  = copyString(end + 1);
+      dir->mtime = mtime;
+      vector_push(dirs, dir);
+    }
+    else if (dir && line[0] == 'f')
+    {
+      abufAppendN(&dir->files, &line[2], len - 1);
+    }
+    else if (dir && line[0] == 's')
+    {
+      abufAppendN(&dir->dirs, &line[2], len - 1);
+      dir->dir_count++;
+    }
+  }
+
+  if (line_no > 2)
+  {
+    index            = calloc_s(1, sizeof(FinderIndex));
+    index->root      = copyString(root);
+    index->dirs      = dirs.data;
+    index->dir_count = dirs.size;
+    linkDirs(index);
+  }
+  else
+  {
+    for (size_t i = 0; i < dirs.size; i++)
+    {
+      freeDir(dirs.data[i]);
+    }
+    free(dirs.data);
+  }
+
+  free(line);
+  fclose(fp);
+  return index;
+}
+
+static bool hasNewline(const abuf *names)
+{
+  return memchr(names->buf, '\n', names->len) != NULL;
+}
+
+static void writeNames(FILE *fp, char kind, const abuf *names)
+{
+  for (size_t at = 0; at < names->len; at += strlen(&names->buf[at]) + 1)
+  {
+    fprintf(fp, "%c %s\n", kind, &names->buf[at]);
+  }
+}
+
+/**
+ * saveCache - Save an index for the next time the editor opens its root
+ * @index: The index
+ *
+ * Written to a temporary file first, another editor reads either the old
+ * cache or the new one.
+ */
+static void saveCache(const FinderIndex *index)
+{
+  char path[EDITOR_PATH_MAX];
+  char temp[EDITOR_PATH_MAX + 8];
+  cachePath(index->root, path, sizeof(path));
+  snprintf(temp, sizeof(temp), "%s.tmp", path);
+
+  FILE *fp = openFile(temp, "wb");
+  if (!fp)
+    return;
+
+  fprintf(fp, "%s\n%s\n", FINDER_CACHE_MAGIC, index->root);
+  for (size_t i = 0; i < index->dir_count; i++)
+  {
+    const FinderDir *dir = index->dirs[i];
+    if (strchr(dir->path, '\n'))
+      continue;
+
+    // A name with a newline can't be saved, the directory is listed again
+    bool partial = hasNewline(&dir->files) || hasNewline(&dir->dirs);
+    fprintf(fp, "d %" PRId64 " %s\n", partial ? -1 : dir->mtime, dir->path);
+    writeNames(fp, 'f', &dir->files);
+    writeNames(fp, 's', &dir->dirs);
+  }
+
+  bool ok = !ferror(fp);
+  if (fclose(fp) == 0 && ok)
+    rename(temp, path);
+  else
+    remove(temp);
+}
+
+static bool isIgnoredDir(const char *name)
+{
+  for (size_t i = 0; i < sizeof(ignored_dirs) / sizeof(ignored_dirs[0]); i++)
+  {
+    if (strcmp(name, ignored_dirs[i]) == 0)
+      return true;
+  }
+  return false;
+}
+
+/**
+ * appendSorted - Append names to a list in sorted order
+ * @out: The list, each name followed by a NUL
+ * @names: Buffer of the names
+ * @offsets: Offset of each name in @names
+ * @count: Number of @offsets
+ */
+static void appendSorted(abuf *out, const abuf *names, const size_t *offsets, size_t count)
+{
+  const char **sorted = malloc_s((count ? count : 1) * sizeof(char *));
+  for (size_t i = 0; i < count; i++)
+  {
+    sorted[i] = &names->buf[offsets[i]];
+  }
+  qsort(sorted, count, sizeof(char *), compareNames);
+
+  for (size_t i = 0; i < count; i++)
+  {
+    abufAppendN(out, sorted[i], strlen(sorted[i]) + 1);
+  }
+  free(sorted);
+}
+
+/**
+ * listDir - Read the entries of a directory
+ * @dir: The directory, its path set
+ *
+ * Links to directories are left out, they could lead back up the tree.
+ */
+static void listDir(FinderDir *dir)
+{
+  DirIter iter = dirFindFirst(dir->path[0] ? dir->path : ".");
+  if (iter.error)
+    return;
+
+  abuf names = ABUF_INIT;
+  VECTOR(size_t) dirs  = {0};
+  VECTOR(size_t) files = {0};
+  do
+  {
+    const char *name = dirGetName(&iter);
+    if (strcmp(name, ".") == 0 || strcmp(name, "..") == 0)
+      continue;
+
+    if (dirIsDir(&iter))
+    {
+      if (dirIsLink(&iter) || isIgnoredDir(name))
+        continue;
+      vector_push(dirs, names.len);
+    }
+    else
+    {
+      vector_push(files, names.len);
+    }
+    abufAppendN(&names, name, strlen(name) + 1);
+  } while (dirNext(&iter));
+  dirClose(&iter);
+
+  appendSorted(&dir->files, &names, files.data, files.size);
+  appendSorted(&dir->dirs, &names, dirs.data, dirs.size);
+  dir->dir_count = dirs.size;
+  dir->listed    = true;
+
+  abufFree(&names);
+  free(dirs.data);
+  free(files.data);
+}
+
+/**
+ * walkDir - Index a directory and queue its subdirectories
+ * @job: The directory
+ * @cache: Index the build starts from, NULL if none
+ * @jobs: Set to the jobs of the subdirectories
+ * @job_count: Set to the number of @jobs
+ *
+ * Safe to call off the UI thread.
+ *
+ * Returns: The directory, NULL if it's gone
+ */
+static FinderDir *walkDir(FinderJob *job, const FinderIndex *cache, FinderJob **jobs,
+                          size_t *job_count)
+{
+  FileInfo info = getFileInfo(job->path[0] ? job->path : ".");
+  if (info.error)
+    return NULL;
+
+  FinderDir *dir = calloc_s(1, sizeof(FinderDir));
+  dir->path      = job->path;
+  dir->mtime     = getFileModTime(info);
+  job->path      = NULL;
+
+  const FinderDir *cached = job->cached;
+  if (cached && cached->mtime == dir->mtime)
+  {
+    abufAppendN(&dir->files, cached->files.buf, cached->files.len);
+    abufAppendN(&dir->dirs, cached->dirs.buf, cached->dirs.len);
+    dir->dir_count = cached->dir_count;
+  }
+  else
+  {
+    listDir(dir);
+  }
+
+  // Subdirectories still there are checked against the cache in turn
+  const char *cached_name = cached ? cached->dirs.buf : NULL;
+  size_t      cached_at   = 0;
+  const char *name        = dir->dirs.buf;
+  for (size_t i = 0; i < dir->dir_count; i++)
+  {
+    while (cached && cached_at < cached->dir_count && strcmp(cached_name, name) < 0)
+    {
+      cached_name += strlen(cached_name) + 1;
+      cached_at++;
+    }
+
+    FinderJob *sub = calloc_s(1, sizeof(FinderJob));
+    sub->path      = joinPath(dir->path, name);
+    if (cached && cached_at < cached->dir_count && strcmp(cached_name, name) == 0 &&
+        cached->children[cached_at] >= 0)
+      sub->cached = cache->dirs[cached->children[cached_at]];
+    sub->next = *jobs;
+    *jobs     = sub;
+    (*job_count)++;
+
+    name += strlen(name) + 1;
+  }
+  return dir;
+}
+
+/**
+ * runJob - Walk the first queued directory
+ *
+ * Must hold the mutex, it's released while the directory is walked.
+ */
+static void runJob(void)
+{
+  FinderJob *job = build.jobs;
+  build.jobs     = job->next;
+  mutexUnlock(&build.mutex);
+
+  FinderJob *jobs      = NULL;
+  size_t     job_count = 0;
+  FinderDir *dir       = walkDir(job, build.cache, &jobs, &job_count);
+  free(job->path);
+  free(job);
+
+  size_t files = 0;
+  if (dir)
+  {
+    for (size_t at = 0; at < dir->files.len; at += strlen(&dir->files.buf[at]) + 1)
+    {
+      files++;
+    }
+  }
+
+  mutexLock(&build.mutex);
+  if (dir)
+    vector_push(build.results, dir);
+  build.found += files;
+
+  // Deeper directories first keeps the queue short
+  while (jobs)
+  {
+    FinderJob *next = jobs->next;
+    jobs->next      = build.jobs;
+    build.jobs      = jobs;
+    jobs            = next;
+    condSignal(&build.work);
+  }
+  build.pending += job_count;
+  build.pending--;
+  condSignal(&build.idle);
+}
+
+static void runMatch(void);
+
+static void walkThread(void *arg)
+{
+  UNUSED(arg);
+
+  mutexLock(&build.mutex);
+  while (true)
+  {
+    while (!build.jobs && build.match_next == build.match_count)
+    {
+      condWait(&build.work, &build.mutex);
+    }
+
+    if (build.match_next < build.match_count)
+      runMatch();
+    else
+      runJob();
+  }
+}
+
+/**
+ * buildIndex - Index the files under a root directory
+ * @root: Full path of the root, the working directory
+ * @cache: Index to start from, NULL to read the cache file
+ *
+ * Directories whose modification time didn't change since @cache are taken
+ * from it, the others are listed again. The walk threads help when there
+ * are any. Saves the cache file when something changed.
+ *
+ * Returns: The index
+ */
+static FinderIndex *buildIndex(char *root, FinderIndex *cache)
+{
+  FinderIndex *loaded = cache ? NULL : loadCache(root);
+  if (loaded)
+    cache = loaded;
+
+  FinderJob *job = calloc_s(1, sizeof(FinderJob));
+  job->path      = copyString("");
+  job->cached    = cache ? findDir(cache, "") : NULL;
+
+  mutexLock(&build.mutex);
+  build.cache   = cache;
+  build.found   = 0;
+  build.jobs    = job;
+  build.pending = 1;
+  condSignal(&build.work);
+  while (build.pending)
+  {
+    if (build.jobs)
+      runJob();
+    else
+      condWait(&build.idle, &build.mutex);
+  }
+
+  FinderIndex *index = calloc_s(1, sizeof(FinderIndex));
+  index->root        = root;
+  index->dirs        = build.results.data;
+  index->dir_count   = build.results.size;
+  build.results.data     = NULL;
+  build.results.size     = 0;
+  build.results.capacity = 0;
+  build.cache            = NULL;
+  mutexUnlock(&build.mutex);
+
+  linkDirs(index);
+  flattenIndex(index);
+
+  bool changed = !cache || index->dir_count != cache->dir_count;
+  for (size_t i = 0; i < index->dir_count && !changed; i++)
+  {
+    changed = index->dirs[i]->listed;
+  }
+  if (changed)
+    saveCache(index);
+
+  freeIndex(loaded);
+  return index;
+}
+
+static void indexThread(void *arg)
+{
+  UNUSED(arg);
+
+  mutexLock(&build.mutex);
+  while (true)
+  {
+    while (!build.requested)
+    {
+      condWait(&build.request, &build.mutex);
+    }
+    build.requested    = false;
+    char        *root  = build.root;
+    FinderIndex *cache = build.cache;
+    build.root         = NULL;
+    mutexUnlock(&build.mutex);
+
+    FinderIndex *index = buildIndex(root, cache);
+
+    mutexLock(&build.mutex);
+    build.done = index;
+    wakeConsole();
+  }
+}
+
+static void startBuilds(void)
+{
+  if (build.started)
+    return;
+
+  build.started = true;
+  mutexInit(&build.mutex);
+  condInit(&build.work);
+  condInit(&build.idle);
+  condInit(&build.request);
+  condInit(&build.matched);
+  for (int i = 0; i < FINDER_WALK_THREADS; i++)
+  {
+    threadStart(walkThread, NULL);
+  }
+  build.thread = threadStart(indexThread, NULL);
+}
+
+static bool isCurrent(const FinderIndex *index)
+{
+  return index && finder.root && strcmp(index->root, finder.root) == 0;
+}
+
+static void runQuery(void);
+
+/**
+ * setIndex - Show the matches of a new index
+ * @index: The index
+ */
+static void setIndex(FinderIndex *index)
+{
+  FinderIndex *old = finder.index;
+  finder.index     = index;
+  finder.narrowed  = false;
+  if (gEditor.state == FINDER_MODE)
+  {
+    runQuery();
+    editorRefreshScreen();
+  }
+  freeIndex(old);
+}
+
+/**
+ * requestIndex - Bring the index of the working directory up to date
+ *
+ * The index is built on the index thread, or right away without one.
+ */
+static void requestIndex(void)
+{
+  startBuilds();
+  FinderIndex *cache = isCurrent(finder.index) ? finder.index : NULL;
+
+  if (!build.thread)
+  {
+    setIndex(buildIndex(copyString(finder.root), cache));
+    return;
+  }
+
+  mutexLock(&build.mutex);
+  if (build.building)
+  {
+    build.again = true;
+  }
+  else
+  {
+    build.building  = true;
+    build.requested = true;
+    build.root      = copyString(finder.root);
+    build.cache     = cache;
+    condSignal(&build.request);
+  }
+  mutexUnlock(&build.mutex);
+}
+
+void editorFinderPoll(void)
+{
+  if (!build.started)
+    return;
+
+  mutexLock(&build.mutex);
+  FinderIndex *index = build.done;
+  bool         again = build.again;
+  if (index)
+  {
+    // The old index isn't read by the builds from here on
+    build.done     = NULL;
+    build.building = false;
+    build.again    = false;
+  }
+  mutexUnlock(&build.mutex);
+
+  if (!index)
+    return;
+
+  setIndex(index);
+  if (again)
+    requestIndex();
+}
+
+// ========== Matching ==========
+
+static inline bool isWordStart(const char *path, int at)
+{
+  if (at == 0)
+    return true;
+  char c = path[at - 1];
+  return c == '/' || c == '\\' || c == '_' || c == '-' || c == '.' || c == ' ';
+}
+
+/**
+ * scoreMatch - Score a path against a query
+ * @path: The path in lower case
+ * @len: Length of @path
+ * @base: Offset of the file name in @path
+ * @query: The query in lower case
+ * @qlen: Length of @query
+ *
+ * The characters of the query must appear in the path in order. The first
+ * pass finds them with memchr, which scans many bytes per step, and most
+ * paths stop there. The match is then tightened from its end backwards,
+ * so it ends as early and starts as late as possible. Matches at the start
+ * of a word, in the file name and next to each other score higher, gaps
+ * score lower.
+ *
+ * Returns: The score, -1 if the path doesn't match
+ */
+static int scoreMatch(const char *path, int len, int base, const char *query, int qlen)
+{
+  // Find the end of the first match
+  const char *p = path;
+  for (int i = 0; i < qlen; i++)
+  {
+    p = memchr(p, query[i], len - (p - path));
+    if (!p)
+      return -1;
+    p++;
+  }
+
+  // Walk back from its end for the shortest match ending there
+  int end = (p - path) - 1;
+  int at  = end;
+  for (int i = qlen - 1; i >= 0; at--)
+  {
+    if (path[at] == query[i])
+      i--;
+  }
+  at++;
+
+  // Score the characters forward from the start of the short match
+  int score = 0;
+  int prev  = -2;
+  for (int i = 0; i < qlen; at++)
+  {
+    if (path[at] != query[i])
+      continue;
+
+    score += 1;
+    if (isWordStart(path, at))
+      score += (at == base) ? 20 : 8;
+    if (at >= base)
+      score += 2;
+    if (at == prev + 1)
+      score += 6;
+    else if (prev >= 0)
+      score -= (at - prev - 1 > 3) ? 3 : at - prev - 1;
+    prev = at;
+    i++;
+  }
+  return (score < 0) ? 0 : score;
+}
+
+static inline int pathLength(const FinderIndex *index, uint32_t id)
+{
+  if (id + 1 < index->count)
+    return index->starts[id + 1] - index->starts[id] - 1;
+  return strlen(&index->paths[index->starts[id]]);
+}
+
+// Higher score first, then the shorter path, then the index order
+static bool isBetter(const FinderIndex *index, uint32_t a, int score_a, uint32_t b, int score_b)
+{
+  if (score_a != score_b)
+    return score_a > score_b;
+
+  int len_a = pathLength(index, a);
+  int len_b = pathLength(index, b);
+  if (len_a != len_b)
+    return len_a < len_b;
+  return a < b;
+}
+
+static void addBest(FinderBest *best, const FinderIndex *index, uint32_t id, int score)
+{
+  int at = best->count;
+  if (at == EDITOR_FINDER_MATCH_MAX)
+  {
+    if (!isBetter(index, id, score, best->ids[at - 1], best->scores[at - 1]))
+      return;
+    at--;
+  }
+  else
+  {
+    best->count++;
+  }
+
+  while (at > 0 && isBetter(index, id, score, best->ids[at - 1], best->scores[at - 1]))
+  {
+    best->ids[at]    = best->ids[at - 1];
+    best->scores[at] = best->scores[at - 1];
+    at--;
+  }
+  best->ids[at]    = id;
+  best->scores[at] = score;
+}
+
+/**
+ * matchPath - Match one path of the index against the query
+ * @index: The index
+ * @id: The path
+ * @query: The query in lower case
+ * @qlen: Length of @query
+ * @qmask: Characters of @query, see charMask()
+ * @best: Best matches so far
+ *
+ * Returns: Whether the path matched
+ */
+static inline bool matchPath(const FinderIndex *index, uint32_t id, const char *query, int qlen,
+                             uint64_t qmask, FinderBest *best)
+{
+  if ((index->masks[id] & qmask) != qmask)
+    return false;
+
+  const char *path  = &index->lower[index->starts[id]];
+  int         score = scoreMatch(path, pathLength(index, id), index->bases[id], query, qlen);
+  if (score < 0)
+    return false;
+
+  addBest(best, index, id, score);
+  return true;
+}
+
+/**
+ * runMatch - Match the next queued part of the query
+ *
+ * Must hold the mutex, it's released while the part is matched.
+ */
+static void runMatch(void)
+{
+  FinderMatch *part = &build.matches[build.match_next++];
+  mutexUnlock(&build.mutex);
+
+  for (size_t i = part->begin; i < part->end; i++)
+  {
+    uint32_t id = query.candidates ? query.candidates[i] : i;
+    if (matchPath(query.index, id, query.text, query.len, query.mask, &part->best))
+      query.kept[part->begin + part->kept++] = id;
+  }
+
+  mutexLock(&build.mutex);
+  if (--build.match_left == 0)
+    condSignal(&build.matched);
+}
+
+/**
+ * matchParts - Match candidates against the query on all threads
+ * @count: Number of candidates
+ * @best: Set to the best matches
+ *
+ * The matches are moved to the start of query.kept in candidate order.
+ *
+ * Returns: Number of matches
+ */
+static size_t matchParts(size_t count, FinderBest *best)
+{
+  size_t parts = (count + FINDER_MATCH_PART - 1) / FINDER_MATCH_PART;
+  build.matches = malloc_s((parts ? parts : 1) * sizeof(FinderMatch));
+  for (size_t i = 0; i < parts; i++)
+  {
+    build.matches[i].begin      = i * FINDER_MATCH_PART;
+    build.matches[i].end        = (i + 1 < parts) ? (i + 1) * FINDER_MATCH_PART : count;
+    build.matches[i].kept       = 0;
+    build.matches[i].best.count = 0;
+  }
+
+  mutexLock(&build.mutex);
+  build.match_count = parts;
+  build.match_next  = 0;
+  build.match_left  = parts;
+  for (size_t i = 1; i < parts && i <= FINDER_WALK_THREADS; i++)
+  {
+    condSignal(&build.work);
+  }
+  while (build.match_left)
+  {
+    if (build.match_next < build.match_count)
+      runMatch();
+    else
+      condWait(&build.matched, &build.mutex);
+  }
+  build.match_count = 0;
+  build.match_next  = 0;
+  mutexUnlock(&build.mutex);
+
+  // Join the parts in order, ties go to the earlier path like in one pass
+  size_t kept = 0;
+  for (size_t i = 0; i < parts; i++)
+  {
+    const FinderMatch *part = &build.matches[i];
+    memmove(&query.kept[kept], &query.kept[part->begin], part->kept * sizeof(uint32_t));
+    kept += part->kept;
+    for (int j = 0; j < part->best.count; j++)
+    {
+      addBest(best, query.index, part->best.ids[j], part->best.scores[j]);
+    }
+  }
+
+  free(build.matches);
+  build.matches = NULL;
+  return kept;
+}
+
+/**
+ * runQuery - Match the index against the text of the prompt
+ *
+ * A query that extends the previous one only checks the paths that
+ * matched before.
+ */
+static void runQuery(void)
+{
+  EditorFinderView *view = &finder.view;
+  view->count            = 0;
+  view->selected         = 0;
+
+  FinderIndex *index = isCurrent(finder.index) ? finder.index : NULL;
+  if (!index)
+  {
+    mutexLock(&build.mutex);
+    size_t found = build.found;
+    mutexUnlock(&build.mutex);
+    snprintf(gEditor.prompt_right, sizeof(gEditor.prompt_right), "Indexing %zu ", found);
+    return;
+  }
+
+  query.index = index;
+  query.len   = 0;
+  query.mask  = 0;
+  for (const char *s = finder.query; *s && query.len < FINDER_QUERY_MAX; s++)
+  {
+    query.text[query.len] = lowerChar(*s);
+    query.mask |= charMask(query.text[query.len]);
+    query.len++;
+  }
+
+  FinderBest best  = {.count = 0};
+  size_t     total = index->count;
+  if (query.len == 0)
+  {
+    finder.narrowed = false;
+    for (size_t i = 0; i < total && i < EDITOR_FINDER_MATCH_MAX; i++)
+    {
+      best.ids[best.count++] = i;
+    }
+  }
+  else
+  {
+    // The matches replace the candidates in place
+    if (!finder.narrowed && finder.candidates.capacity < index->count)
+    {
+      finder.candidates.data     = realloc_s(finder.candidates.data,
+                                             index->count * sizeof(uint32_t));
+      finder.candidates.capacity = index->count;
+    }
+
+    size_t count     = finder.narrowed ? finder.candidates.size : index->count;
+    query.candidates = finder.narrowed ? finder.candidates.data : NULL;
+    query.kept       = finder.candidates.data;
+
+    total                  = matchParts(count, &best);
+    finder.candidates.size = total;
+    finder.narrowed        = true;
+  }
+
+  for (int i = 0; i < best.count; i++)
+  {
+    view->paths[i] = &index->paths[index->starts[best.ids[i]]];
+  }
+  view->count = best.count;
+  snprintf(gEditor.prompt_right, sizeof(gEditor.prompt_right), "%zu/%zu ", total, index->count);
+}
+
+static void editorFinderCallback(char *query, int key)
+{
+  EditorFinderView *view = &finder.view;
+  switch (key)
+  {
+    case ARROW_UP:
+      if (view->selected > 0)
+        view->selected--;
+      return;
+
+    case ARROW_DOWN:
+      if (view->selected + 1 < view->count)
+        view->selected++;
+      return;
+
+    case ESC:
+    case CTRL_KEY('x'):
+    case '\r':
+    case MOUSE_PRESSED:
+      gEditor.prompt_right[0] = '\0';
+      return;
+  }
+
+  // Only a query that grows keeps the matches of the last one
+  size_t len = strlen(finder.query);
+  if (strncmp(query, finder.query, len) != 0)
+    finder.narrowed = false;
+  snprintf(finder.query, sizeof(finder.query), "%s", query);
+  runQuery();
+}
+
+void editorFinder(void)
+{
+  if (gEditor.file_count >= EDITOR_FILE_MAX_SLOT)
+  {
+    editorMsg("Reached max file slots! Cannot open more files.");
+    return;
+  }
+
+  free(finder.root);
+  finder.root     = copyString(getFullPath("."));
+  finder.query[0] = '\0';
+  finder.narrowed = false;
+
+  // Matches come from the index at hand while it's checked for changes
+  requestIndex();
+  runQuery();
+
+  char *query = editorPrompt("Go to file: %s", FINDER_MODE, editorFinderCallback);
+  if (!query)
+    return;
+
+  if (finder.view.count)
+  {
+    char *path = copyString(finder.view.paths[finder.view.selected]);
+    editorOpenPath(path);
+    free(path);
+  }
+  free(query);
+}
+
+const EditorFinderView *editorFinderGetView(void)
+{
+  return &finder.view;
+}
+
+void editorFinderFree(void)
+{
+  // A running build still reads the index, it goes with the process
+  bool building = false;
+  if (build.started)
+  {
+    mutexLock(&build.mutex);
+    building = build.building;
+    mutexUnlock(&build.mutex);
+  }
+  if (!building)
+    freeIndex(finder.index);
+
+  free(finder.root);
+  free(finder.candidates.data);
+}
@@ -0,0 +1,53 @@
+#ifndef FINDER_H
+#define FINDER_H
+
+#include "utils.h"
+
+// Matches kept for the list of the go to file prompt
+#define EDITOR_FINDER_MATCH_MAX 64
+
+// Rows of the list above the prompt
+#define EDITOR_FINDER_ROWS 10
+
+/**
+ * struct EditorFinderView - Matches shown by the go to file prompt
+ * @paths: Best matches first, relative to the working directory
+ * @count: Number of @paths
+ * @selected: Index of the selected match
+ */
+typedef struct EditorFinderView
+{
+  const char *paths[EDITOR_FINDER_MATCH_MAX];
+  int         count;
+  int         selected;
+} EditorFinderView;
+
+/**
+ * editorFinder - Open a file by fuzzy matching its path
+ *
+ * Matches the typed text against the files under the working directory
+ * and opens the selected match on enter. The file index is read from the
+ * cache and brought up to date in the background, the list follows it.
+ */
+void editorFinder(void);
+
+/**
+ * editorFinderPoll - Take the file index built in the background
+ *
+ * Called by a console read after a background thread woke it up.
+ */
+void editorFinderPoll(void);
+
+/**
+ * editorFinderGetView - Get the matches of the go to file prompt
+ *
+ * Returns: Pointer to the matches, valid until the next key press
+ */
+const EditorFinderView *editorFinderGetView(void);
+
+/**
+ * editorFinderFree - Free the file index
+ */
+void editorFinderFree(void);
+
+#endif
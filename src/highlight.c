@@ -4,6 +4,7 @@
 #include "config.h"
 #include "editor.h"
 #include "os.h"
+#include "prompt.h"
 
 #include <ctype.h>
 
@@ -12,101 +13,636 @@
 #define JSON_MALLOC malloc_s
 #include "json.h"
 
+static void editorLoadSyntax(EditorSyntax *syntax);
+
 /**
- * editorUpdateSyntax - Update syntax highlighting for a single row
- * @file: The file containing the row
- * @row: The row to update highlighting for
- * 
- * Performs syntax highlighting on a single line based on the file's
- * syntax definition. Handles:
- * - Single-line comments
- * - Multi-line comments (with state tracking across lines)
- * - String literals (with escape sequences)
- * - Numbers (decimal, hex, octal, float)
- * - Keywords (3 categories)
- * - Trailing whitespace
- * 
- * The function uses a state machine approach and may recursively
- * update the next line if multi-line comment state changes.
+ * hashDelimiter - Hash a heredoc delimiter into a state argument
  */
-void editorUpdateSyntax(EditorFile *file, EditorRow *row)
+static uint32_t hashDelimiter(const char *s, int len)
 {
-  if (row->hl)
+  uint32_t hash = 2166136261u;
+  for (int i = 0; i < len; i++)
   {
-    // Reset all highlighting to normal
-    // Note: realloc might return NULL when row->size == 0
-    memset(row->hl, HL_NORMAL, row->size);
+    hash ^= (uint8_t) s[i];
+    hash *= 16777619u;
   }
+  // Fold to 24 bits
+  return ((hash >> 24) ^ hash) & HL_FRAME_MAX_ARG;
+}
 
-  EditorSyntax *s = file->syntax;
+/**
+ * matchFenced - Match a delimiter whose fence character may repeat
+ * @delim: The delimiter
+ * @fence: The fence character in @delim
+ * @data: Row data
+ * @size: Row size
+ * @i: Position to match at
+ * @count: In: required fence count (-1 for any), out: fence count matched
+ *
+ * Returns: Length of the match, 0 if it does not match
+ */
+static int matchFenced(const char *delim, char fence, const char *data, int size, int i,
+                       int *count)
+{
+  const char *split = strchr(delim, fence);
+  int         pre   = split - delim;
+  int         j     = i;
 
-  // Skip if syntax highlighting is disabled or no syntax defined
-  if (!CONVAR_GETINT(syntax) || !s)
-    goto update_trailing;
+  if (size - j < pre || strncmp(&data[j], delim, pre) != 0)
+    return 0;
+  j += pre;
 
-  // Get comment delimiters from syntax definition
-  const char *scs = s->singleline_comment_start;
-  const char *mcs = s->multiline_comment_start;
-  const char *mce = s->multiline_comment_end;
+  int n = 0;
+  while (j < size && data[j] == fence && (*count < 0 || n < *count))
+  {
+    n++;
+    j++;
+  }
+  if (*count >= 0 && n != *count)
+    return 0;
+
+  const char *post     = split + 1;
+  int         post_len = strlen(post);
+  if (size - j < post_len || strncmp(&data[j], post, post_len) != 0)
+    return 0;
+
+  *count = n;
+  return j + post_len - i;
+}
+
+/**
+ * matchRegionStart - Match the start delimiter of a region
+ * @r: The region
+ * @row: The row
+ * @i: Position to match at
+ * @arg: Set to the argument of the region state
+ *
+ * Returns: Length of the match, 0 if it does not match
+ */
+static int matchRegionStart(const EditorSyntaxRegion *r, const EditorRow *row, int i,
+                            uint32_t *arg)
+{
+  if (r->fence)
+  {
+    int count = -1;
+    int len   = matchFenced(r->start, r->fence, row->data, row->size, i, &count);
+    *arg      = count;
+    return len;
+  }
+
+  int len = strlen(r->start);
+  if (row->size - i < len || strncmp(&row->data[i], r->start, len) != 0)
+    return 0;
+
+  if (!(r->flags & HL_REGION_HEREDOC))
+  {
+    *arg = 0;
+    return len;
+  }
+
+  // <<EOF, <<-EOF, <<~EOF, <<'EOF' and <<"EOF"
+  int j = i + len;
+  if (j < row->size && (row->data[j] == '-' || row->data[j] == '~'))
+    j++;
+
+  char quote = 0;
+  if (j < row->size && (row->data[j] == '\'' || row->data[j] == '"'))
+    quote = row->data[j++];
+
+  int word = j;
+  if (j >= row->size || !(isalpha((uint8_t) row->data[j]) || row->data[j] == '_'))
+    return 0;
+  while (j < row->size && (isalnum((uint8_t) row->data[j]) || row->data[j] == '_'))
+    j++;
+
+  *arg = hashDelimiter(&row->data[word], j - word);
+
+  if (quote && j < row->size && row->data[j] == quote)
+    j++;
+  return j - i;
+}
+
+/**
+ * matchRegionEnd - Match the end delimiter of a region
+ *
+ * Returns: Length of the match, 0 if it does not match
+ */
+static int matchRegionEnd(const EditorSyntaxRegion *r, const EditorRow *row, int i, uint32_t arg)
+{
+  if (r->fence && strchr(r->end, r->fence))
+  {
+    int count = arg;
+    return matchFenced(r->end, r->fence, row->data, row->size, i, &count);
+  }
+
+  int len = strlen(r->end);
+  if (row->size - i < len || strncmp(&row->data[i], r->end, len) != 0)
+    return 0;
+  return len;
+}
+
+/**
+ * highlightRegion - Highlight the inside of a region
+ * @r: The region
+ * @row: The row
+ * @i: Position after the start delimiter, or the row start
+ * @indent: Position of the first non-blank character of the row
+ * @arg: Region argument, updated for nested regions
+ * @stop: Position the lexer wants control back at, see HlRun
+ * @closed: Set to true if the region ends on this row
+ *
+ * Returns: Position after the end delimiter, or the position where the
+ *          region stopped without closing
+ */
+static int highlightRegion(const EditorSyntaxRegion *r, EditorRow *row, int i, int indent,
+                           uint32_t *arg, int stop, bool *closed)
+{
+  *closed = false;
+
+  if (r->flags & HL_REGION_HEREDOC)
+  {
+    // The delimiter must be alone on its row
+    int end = row->size;
+    while (end > indent && isSpace(row->data[end - 1]))
+      end--;
+
+    memset(&row->hl[i], r->hl, row->size - i);
+    *closed = (hashDelimiter(&row->data[indent], end - indent) == *arg);
+    return row->size;
+  }
+
+  while (i < row->size && i < stop)
+  {
+    bool at_line_start = !(r->flags & HL_REGION_LINE_START) || i == indent;
+
+    if ((r->flags & HL_REGION_ESCAPE) && row->data[i] == '\\' && i + 1 < row->size)
+    {
+      row->hl[i]     = r->hl;
+      row->hl[i + 1] = r->hl;
+      i += 2;
+      continue;
+    }
+
+    int len = at_line_start ? matchRegionEnd(r, row, i, *arg) : 0;
+    if (len)
+    {
+      memset(&row->hl[i], r->hl, len);
+      i += len;
+      if ((r->flags & HL_REGION_NESTED) && *arg > 0)
+      {
+        (*arg)--;
+        continue;
+      }
+      *closed = true;
+      return i;
+    }
+
+    uint32_t unused;
+    if ((r->flags & HL_REGION_NESTED) && (len = matchRegionStart(r, row, i, &unused)))
+    {
+      memset(&row->hl[i], r->hl, len);
+      i += len;
+      if (*arg < HL_FRAME_MAX_ARG)
+        (*arg)++;
+      continue;
+    }
+
+    row->hl[i] = r->hl;
+    i++;
+  }
+  return i;
+}
+
+/**
+ * matchNoCase - Match a string case-insensitively
+ *
+ * Returns: Length of the match, 0 if it does not match
+ */
+static int matchNoCase(const EditorRow *row, int i, const char *str)
+{
+  int len = strlen(str);
+  if (row->size - i < len)
+    return 0;
+
+  for (int j = 0; j < len; j++)
+  {
+    if (tolower((uint8_t) row->data[i + j]) != tolower((uint8_t) str[j]))
+      return 0;
+  }
+  return len;
+}
+
+/**
+ * findNoCase - Find a string case-insensitively
+ * @row: The row
+ * @i: Position to search from
+ * @str: The string
+ * @len: Set to the length of the match, 0 if there is none
+ *
+ * Returns: Position of the first match, or the row size if there is none
+ */
+static int findNoCase(const EditorRow *row, int i, const char *str, int *len)
+{
+  // Jump between candidates when the first character has no case
+  int  first    = (uint8_t) str[0];
+  bool caseless = (tolower(first) == toupper(first));
+
+  for (int p = i; p < row->size; p++)
+  {
+    if (caseless)
+    {
+      const char *next = memchr(&row->data[p], first, row->size - p);
+      if (!next)
+        break;
+      p = next - row->data;
+    }
+
+    if ((*len = matchNoCase(row, p, str)))
+      return p;
+  }
+  *len = 0;
+  return row->size;
+}
+
+static EditorSyntax *editorGetSyntaxById(uint32_t id);
+
+/**
+ * matchEmbedStart - Match the start of an embedded syntax
+ * @s: The outer syntax
+ * @row: The row
+ * @i: Position to match at
+ * @indent: Position of the first non-blank character of the row
+ * @prev_sep: The previous character was a separator
+ * @frame: Set to the frame of the embed
+ * @content: Set to the position where the embedded text starts
+ *
+ * Returns: Length of the start delimiter, 0 if no embed starts here
+ */
+static int matchEmbedStart(const EditorSyntax *s, EditorRow *row, int i, int indent,
+                           bool prev_sep, uint32_t *frame, int *content)
+{
+  for (size_t k = 0; k < s->embeds.size && k < HL_FRAME_EMBED - 1; k++)
+  {
+    const EditorSyntaxEmbed *e = &s->embeds.data[k];
 
-  int scs_len = scs ? strlen(scs) : 0;
-  int mcs_len = mcs ? strlen(mcs) : 0;
-  int mce_len = mce ? strlen(mce) : 0;
+    if ((e->flags & HL_EMBED_LINE_START) && i != indent)
+      continue;
+
+    if (!prev_sep && !isNonIdentifierChar(e->start[0]))
+      continue;
+
+    int len = matchNoCase(row, i, e->start);
+    if (!len)
+      continue;
+
+    // "<script" must not match "<scripts"
+    int j = i + len;
+    if (!isNonIdentifierChar(e->start[len - 1]) && j < row->size &&
+        !isNonIdentifierChar(row->data[j]))
+      continue;
 
-  // State variables for syntax highlighting
-  int prev_sep   = 1;  // Previous character was a separator
-  int in_string  = 0;  // Currently inside a string (stores opening quote char)
-  int row_index  = (int) (row - file->row);
-  int in_comment = (row_index > 0 && file->row[row_index - 1].hl_open_comment);
+    EditorSyntax *inner = NULL;
+    int           start = row->size;
+    if (e->flags & HL_EMBED_INFO)
+    {
+      // ```lang, the rest of the row is the info string
+      while (j < row->size && isSpace(row->data[j]))
+        j++;
+
+      int  word = j;
+      char name[32];
+      while (j < row->size && !isSpace(row->data[j]) && row->data[j] != '{')
+        j++;
+      if (j == word || j - word >= (int) sizeof(name))
+        continue;
+
+      memcpy(name, &row->data[word], j - word);
+      name[j - word] = '\0';
+      inner          = editorFindSyntaxByName(name);
+      j              = row->size;
+    }
+    else
+    {
+      inner = editorFindSyntaxByName(e->syntax);
+      if (!e->open)
+      {
+        start = j;
+      }
+      else
+      {
+        for (int p = j; p < row->size; p++)
+        {
+          int open_len = matchNoCase(row, p, e->open);
+          if (open_len)
+          {
+            start = p + open_len;
+            break;
+          }
+        }
+      }
+    }
+
+    if (!inner || inner == s)
+      continue;
+
+    memset(&row->hl[i], e->hl, j - i);
+    *frame   = HL_FRAME(HL_FRAME_EMBED | k, inner->id);
+    *content = start;
+    return j - i;
+  }
+  return 0;
+}
+
+/**
+ * struct HlSpan - Lexer state local to a span of one syntax
+ * @heredoc: Heredoc starting on the next row
+ * @embed: Embed whose text starts at @embed_at
+ * @embed_at: Position where the embedded text starts, -1 if none
+ * @in_string: Opening quote of the string the lexer is in, 0 if none
+ * @prev_sep: The previous character was a separator
+ */
+typedef struct HlSpan
+{
+  uint32_t heredoc;
+  uint32_t embed;
+  int      embed_at;
+  char     in_string;
+  bool     prev_sep;
+} HlSpan;
+
+static const HlSpan hl_span_start = {0, 0, -1, 0, true};
+
+/**
+ * struct HlLexer - State of the lexer at a position of a row
+ * @outer: Frame of the file syntax
+ * @inner: Frame of the embedded syntax while @outer is inside an embed
+ * @span: State of the span being highlighted
+ */
+typedef struct HlLexer
+{
+  uint32_t outer;
+  uint32_t inner;
+  HlSpan   span;
+} HlLexer;
+
+/**
+ * struct EditorHlChunk - Lexer state where a chunk of a long row starts
+ * @pos: First position the lexer stopped at in the chunk
+ * @lexer: State of the lexer at @pos
+ *
+ * The lexer stops between tokens only, so @pos may be past the chunk start
+ * when a token crosses it.
+ */
+typedef struct EditorHlChunk
+{
+  int     pos;
+  HlLexer lexer;
+} EditorHlChunk;
+
+/**
+ * struct EditorHlChunks - Lexer states of a long row, one per chunk
+ * @from: Outgoing state of the previous row the states continue from
+ * @count: Number of states
+ * @capacity: Allocated states
+ * @data: The states, by position
+ */
+typedef struct EditorHlChunks
+{
+  EditorHlState from;
+  int           count;
+  int           capacity;
+  EditorHlChunk data[];
+} EditorHlChunks;
+
+// Bytes between two lexer states of a long row
+#define HL_CHUNK_SIZE 4096
+
+// Bytes the lexer may read past a token to decide it, less than a chunk
+#define HL_LOOKAHEAD 256
+
+/**
+ * struct HlRun - Highlighting pass over a long row
+ * @chunks: Lexer states recorded so far, NULL if none
+ * @record_at: Position from which the next state is recorded
+ * @next: Position the lexer calls hlCheckpoint() again at
+ * @old: States from before an edit, NULL on a full pass
+ * @old_count: Number of states in @old
+ * @old_at: Next state of @old to compare with
+ * @delta: Bytes the edit inserted, negative if it removed bytes
+ * @stopped: The lexer reached a state of @old
+ *
+ * After an edit the pass starts from a state before the edit and stops at
+ * the first state after it that matches the state from before the edit at
+ * the same text, the highlighting of the rest of the row is still valid.
+ */
+typedef struct HlRun
+{
+  EditorHlChunks      *chunks;
+  int                  record_at;
+  int                  next;
+  const EditorHlChunk *old;
+  int                  old_count;
+  int                  old_at;
+  int                  delta;
+  bool                 stopped;
+} HlRun;
+
+static bool sameLexer(const EditorHlChunk *old, const HlLexer *lexer, int delta)
+{
+  const HlSpan *a = &old->lexer.span;
+  const HlSpan *b = &lexer->span;
+  return old->lexer.outer == lexer->outer && old->lexer.inner == lexer->inner &&
+         a->heredoc == b->heredoc && a->embed == b->embed &&
+         ((a->embed_at < 0) ? b->embed_at < 0 : a->embed_at + delta == b->embed_at) &&
+         a->in_string == b->in_string && a->prev_sep == b->prev_sep;
+}
+
+/**
+ * hlCheckpoint - Record the lexer state at the start of a chunk
+ * @run: The pass
+ * @i: Position of the lexer, between two tokens
+ * @lexer: State of the lexer
+ *
+ * Returns: true if the lexer state matches the one from before the edit,
+ *          the lexer stops then
+ */
+static bool hlCheckpoint(HlRun *run, int i, const HlLexer *lexer)
+{
+  if (run->old)
+  {
+    while (run->old_at < run->old_count && run->old[run->old_at].pos + run->delta < i)
+    {
+      run->old_at++;
+    }
+
+    if (run->old_at < run->old_count && run->old[run->old_at].pos + run->delta == i)
+    {
+      if (sameLexer(&run->old[run->old_at], lexer, run->delta))
+      {
+        run->stopped = true;
+        return true;
+      }
+      run->old_at++;
+    }
+  }
+
+  if (i >= run->record_at)
+  {
+    EditorHlChunks *chunks = run->chunks;
+    if (!chunks || chunks->count == chunks->capacity)
+    {
+      int capacity = chunks ? chunks->capacity * 2 : 16;
+      chunks = realloc_s(chunks, sizeof(EditorHlChunks) + sizeof(EditorHlChunk) * capacity);
+      if (!run->chunks)
+        chunks->count = 0;
+      chunks->capacity = capacity;
+      run->chunks      = chunks;
+    }
+    chunks->data[chunks->count++] = (EditorHlChunk){i, *lexer};
+    run->record_at                = i + HL_CHUNK_SIZE;
+  }
+
+  run->next = run->record_at;
+  if (run->old && run->old_at < run->old_count &&
+      run->old[run->old_at].pos + run->delta < run->next)
+    run->next = run->old[run->old_at].pos + run->delta;
+  return false;
+}
+
+/**
+ * highlightSpan - Highlight part of a row with one syntax
+ * @s: The syntax
+ * @row: The row, its size is where the span ends
+ * @i: Position where the span starts
+ * @indent: Position of the first non-blank character of the row
+ * @lexer: Lexer state at @i, updated to the state at the end
+ * @embeds: Whether embedded syntax definitions may start, only the file
+ *          syntax embeds others, it uses the outer frame and the embedded
+ *          syntax the inner one
+ * @run: Pass over a long row, NULL for other rows
+ *
+ * Handles:
+ * - Single-line comments
+ * - Regions spanning several rows (multi-line comments, raw strings,
+ *   heredocs, ...) with state tracking across lines
+ * - String literals (with escape sequences)
+ * - Numbers (decimal, hex, octal, float)
+ * - Keywords (3 categories)
+ *
+ * Every character of the span is written, so a pass that starts in the
+ * middle of a row needs no reset before it.
+ *
+ * Returns: The end of the span, the position where embedded text starts,
+ *          in which case the frame holds the embed, or the position where
+ *          @run stopped the lexer
+ */
+static int highlightSpan(const EditorSyntax *s, EditorRow *row, int i, int indent, HlLexer *lexer,
+                         bool embeds, HlRun *run)
+{
+  uint32_t *frame = embeds ? &lexer->outer : &lexer->inner;
+  HlSpan   *span  = &lexer->span;
+
+  // Get comment delimiters from syntax definition
+  const char *scs     = s->singleline_comment_start;
+  int         scs_len = scs ? strlen(scs) : 0;
 
-  int i = 0;
   while (i < row->size)
   {
+    if (run && i >= run->next && hlCheckpoint(run, i, lexer))
+      return i;
+
     char c = row->data[i];
 
+    // The embedded text starts here
+    if (span->embed_at >= 0 && i >= span->embed_at)
+    {
+      *frame = span->embed;
+      return span->embed_at;
+    }
+
+    // Inside a region
+    if (HL_FRAME_REGION(*frame))
+    {
+      const EditorSyntaxRegion *r    = &s->regions.data[HL_FRAME_REGION(*frame) - 1];
+      uint32_t                  arg  = HL_FRAME_ARG(*frame);
+      int                       stop = run ? run->next : row->size;
+      bool                      closed;
+
+      i              = highlightRegion(r, row, i, indent, &arg, stop, &closed);
+      *frame         = closed ? 0 : HL_FRAME(HL_FRAME_REGION(*frame), arg);
+      span->prev_sep = true;
+      continue;
+    }
+
     // Handle single-line comments
-    if (scs_len && !in_string && !in_comment)
+    if (scs_len && !span->in_string)
     {
       if (i + scs_len <= row->size && strncmp(&row->data[i], scs, scs_len) == 0)
       {
         // Rest of line is a comment
         memset(&row->hl[i], HL_COMMENT, row->size - i);
+        i = row->size;
         break;
       }
     }
 
-    // Handle multi-line comments
-    if (mcs_len && mce_len && !in_string)
+    // Handle the start of an embedded syntax
+    if (embeds && span->embed_at < 0 && !span->in_string)
     {
-      if (in_comment)
+      int len = matchEmbedStart(s, row, i, indent, span->prev_sep, &span->embed, &span->embed_at);
+      if (len)
       {
-        // Currently inside a multi-line comment
-        row->hl[i] = HL_COMMENT;
-        if (i + mce_len <= row->size && strncmp(&row->data[i], mce, mce_len) == 0)
-        {
-          // Found comment end delimiter
-          memset(&row->hl[i], HL_COMMENT, mce_len);
-          i += mce_len;
-          in_comment = 0;
-          prev_sep   = 1;
-        }
-        i++;
+        i += len;
+        span->prev_sep = true;
         continue;
       }
-      else if (i + mcs_len <= row->size && strncmp(&row->data[i], mcs, mcs_len) == 0)
+    }
+
+    // Handle the start of a region
+    if (!span->in_string)
+    {
+      bool found_region = false;
+      for (size_t j = 0; j < s->regions.size && j < HL_FRAME_EMBED - 1; j++)
       {
-        // Found comment start delimiter
-        memset(&row->hl[i], HL_COMMENT, mcs_len);
-        i += mcs_len;
-        in_comment = 1;
-        continue;
+        const EditorSyntaxRegion *r = &s->regions.data[j];
+        uint32_t                  arg;
+
+        if ((r->flags & HL_REGION_LINE_START) && i != indent)
+          continue;
+
+        // Prefixed delimiters such as r"..." must not end an identifier
+        if (!span->prev_sep && !isNonIdentifierChar(r->start[0]))
+          continue;
+
+        int len = matchRegionStart(r, row, i, &arg);
+        if (!len)
+          continue;
+
+        memset(&row->hl[i], r->hl, len);
+        i += len;
+        found_region = true;
+
+        // The heredoc body starts on the next row
+        if (r->flags & HL_REGION_HEREDOC)
+        {
+          if (!span->heredoc)
+            span->heredoc = HL_FRAME(j + 1, arg);
+          span->prev_sep = true;
+          break;
+        }
+
+        *frame = HL_FRAME(j + 1, arg);
+        break;
       }
+
+      if (found_region)
+        continue;
     }
 
     // Handle string literals
     if (s->flags & HL_HIGHLIGHT_STRINGS)
     {
-      if (in_string)
+      if (span->in_string)
       {
         row->hl[i] = HL_STRING;
         
@@ -119,17 +655,17 @@ void editorUpdateSyntax(EditorFile *file, EditorRow *row)
         }
         
         // Check for closing quote
-        if (c == in_string)
-          in_string = 0;
+        if (c == span->in_string)
+          span->in_string = 0;
         i++;
-        prev_sep = 1;
+        span->prev_sep = true;
         continue;
       }
       else if (c == '"' || c == '\'')
       {
         // Start of string
-        in_string  = c;
-        row->hl[i] = HL_STRING;
+        span->in_string = c;
+        row->hl[i]      = HL_STRING;
         i++;
         continue;
       }
@@ -138,7 +674,7 @@ void editorUpdateSyntax(EditorFile *file, EditorRow *row)
     // Handle number literals
     if (s->flags & HL_HIGHLIGHT_NUMBERS)
     {
-      if ((isdigit((uint8_t) c) || c == '.') && prev_sep)
+      if ((isdigit((uint8_t) c) || c == '.') && span->prev_sep)
       {
         int start = i;
         i++;
@@ -200,22 +736,25 @@ void editorUpdateSyntax(EditorFile *file, EditorRow *row)
         
         // Don't highlight lone '.' as a number
         if (c == '.' && i - start == 1)
+        {
+          row->hl[start] = HL_NORMAL;
           continue;
+        }
 
         // Handle float suffix (f or F)
         if (i < row->size && (row->data[i] == 'f' || row->data[i] == 'F'))
           i++;
           
         // Only highlight if followed by separator or whitespace
-        if (i == row->size || isSeparator(row->data[i]) || isSpace(row->data[i]))
-          memset(&row->hl[start], HL_NUMBER, i - start);
-        prev_sep = 0;
+        bool number = (i == row->size || isSeparator(row->data[i]) || isSpace(row->data[i]));
+        memset(&row->hl[start], number ? HL_NUMBER : HL_NORMAL, i - start);
+        span->prev_sep = false;
         continue;
       }
     }
 
     // Handle keywords (only after separators)
-    if (prev_sep)
+    if (span->prev_sep)
     {
       bool found_keyword = false;
       
@@ -245,54 +784,526 @@ void editorUpdateSyntax(EditorFile *file, EditorRow *row)
 
       if (found_keyword)
       {
-        prev_sep = 0;
+        span->prev_sep = false;
         continue;
       }
     }
     
     // Update separator state
-    prev_sep = isNonIdentifierChar(c);
+    span->prev_sep = isNonIdentifierChar(c);
+    row->hl[i]     = HL_NORMAL;
     i++;
   }
-  
-  // Update multi-line comment state
-  int changed          = (row->hl_open_comment != in_comment);
-  row->hl_open_comment = in_comment;
-  
-  // Recursively update next line if comment state changed
-  if (changed && row_index + 1 < file->num_rows)
-    editorUpdateSyntax(file, &file->row[row_index + 1]);
 
-  // Highlight trailing whitespace
-update_trailing:
-  for (i = row->size - 1; i >= 0; i--)
+  if (span->embed_at >= 0)
+  {
+    *frame = span->embed;
+    return span->embed_at;
+  }
+
+  // A heredoc starts on the next row unless the row ends in another region
+  if (span->heredoc && !HL_FRAME_REGION(*frame))
+    *frame = span->heredoc;
+
+  return i;
+}
+
+/**
+ * validFrame - Check that a cached frame still fits a syntax
+ */
+static uint32_t validFrame(const EditorSyntax *s, uint32_t frame)
+{
+  int region = HL_FRAME_REGION(frame);
+  if (region & HL_FRAME_EMBED)
+    return ((size_t) (region & ~HL_FRAME_EMBED) < s->embeds.size) ? frame : 0;
+  return ((size_t) region <= s->regions.size) ? frame : 0;
+}
+
+/**
+ * highlightLexer - Highlight the rest of a row from a lexer state
+ * @s: The syntax of the file
+ * @row: The row
+ * @i: Position to start at, between two tokens
+ * @indent: Position of the first non-blank character of the row
+ * @lexer: Lexer state at @i, updated to the state at the end of the row
+ * @run: Pass over a long row, NULL for other rows
+ *
+ * Switches to the embedded syntax between the delimiters of an embed.
+ */
+static void highlightLexer(EditorSyntax *s, EditorRow *row, int i, int indent, HlLexer *lexer,
+                           HlRun *run)
+{
+  while (i < row->size)
+  {
+    if (!(HL_FRAME_REGION(lexer->outer) & HL_FRAME_EMBED))
+    {
+      i = highlightSpan(s, row, i, indent, lexer, true, run);
+      if (run && run->stopped)
+        return;
+      lexer->inner = 0;
+      lexer->span  = hl_span_start;
+      continue;
+    }
+
+    // Inside an embed, find where it ends on this row
+    const EditorSyntaxEmbed *e = &s->embeds.data[HL_FRAME_REGION(lexer->outer) & ~HL_FRAME_EMBED];
+    EditorSyntax            *embed   = editorGetSyntaxById(HL_FRAME_ARG(lexer->outer));
+    int                      end     = row->size;
+    int                      end_len = 0;
+
+    if (e->flags & HL_EMBED_LINE_START)
+    {
+      if (i <= indent && (end_len = matchNoCase(row, indent, e->end)))
+        end = indent;
+    }
+    else
+    {
+      end = findNoCase(row, i, e->end, &end_len);
+    }
+
+    if (embed)
+    {
+      if (!embed->loaded)
+        editorLoadSyntax(embed);
+
+      // Highlight up to the end delimiter only
+      EditorRow view = *row;
+      view.size      = end;
+      lexer->inner   = validFrame(embed, lexer->inner);
+      highlightSpan(embed, &view, i, indent, lexer, false, run);
+      if (run && run->stopped)
+        return;
+    }
+    else
+    {
+      memset(&row->hl[i], HL_NORMAL, end - i);
+    }
+
+    if (!end_len)
+      break;
+
+    memset(&row->hl[end], e->hl, end_len);
+    i            = end + end_len;
+    lexer->outer = 0;
+    lexer->inner = 0;
+    lexer->span  = hl_span_start;
+  }
+}
+
+static inline EditorHlState lexerState(const HlLexer *lexer)
+{
+  return HL_STATE(lexer->outer,
+                  (HL_FRAME_REGION(lexer->outer) & HL_FRAME_EMBED) ? lexer->inner : 0);
+}
+
+// Highlight of trailing whitespace, it replaces the highlight of the syntax
+#define HL_TRAILING (HL_BG_TRAILING << HL_FG_BITS)
+
+static void markTrailing(EditorRow *row)
+{
+  for (int i = row->size - 1; i >= 0; i--)
   {
     if (row->data[i] == ' ' || row->data[i] == '\t')
     {
-      row->hl[i] = HL_BG_TRAILING << HL_FG_BITS;
+      row->hl[i] = HL_TRAILING;
+    }
+    else
+    {
+      break;
     }
+  }
+}
+
+static int rowIndent(const EditorRow *row)
+{
+  int indent = 0;
+  while (indent < row->size && isSpace(row->data[indent]))
+    indent++;
+  return indent;
+}
+
+/**
+ * highlightRow - Highlight a single row from the state of the previous row
+ * @file: The file containing the row
+ * @row: The row to update highlighting for
+ * 
+ * Highlights the row with the file's syntax, switching to the embedded
+ * syntax between the delimiters of an embed, then marks trailing
+ * whitespace. Long rows keep the lexer state at the start of each chunk,
+ * so an edit only highlights the chunks around it again, see
+ * highlightRowEdit().
+ *
+ * Returns: true if the outgoing lexer state of the row changed
+ */
+static bool highlightRow(EditorFile *file, EditorRow *row)
+{
+  if (row->hl)
+  {
+    // Reset all highlighting to normal
+    // Note: realloc might return NULL when row->size == 0
+    memset(row->hl, HL_NORMAL, row->size);
+  }
+
+  EditorSyntax *s         = file->syntax;
+  int           row_index = (int) (row - file->row);
+  EditorHlState state     = 0;
+  HlRun         run       = {0};
+
+  // Skip if syntax highlighting is disabled or no syntax defined
+  if (!CONVAR_GETINT(syntax) || !s || (file->largefile & LARGEFILE_SYNTAX))
+    goto update_trailing;
+
+  // Parse the definition the first time it is used
+  if (!s->loaded)
+    editorLoadSyntax(s);
+
+  // First non-blank character, for delimiters that must start a row
+  int indent = rowIndent(row);
+
+  // Continue from the state the previous row ended in
+  if (row_index > 0)
+    state = file->row[row_index - 1].hl_state;
+
+  HlLexer lexer = {validFrame(s, HL_STATE_OUTER(state)), HL_STATE_INNER(state), hl_span_start};
+  highlightLexer(s, row, 0, indent, &lexer, editorRowIsLong(row) ? &run : NULL);
+  if (run.chunks)
+    run.chunks->from = state;
+  state = lexerState(&lexer);
+
+  // Highlight trailing whitespace
+update_trailing:
+  markTrailing(row);
+
+  free(row->hl_chunks);
+  row->hl_chunks = run.chunks;
+
+  // Update the cached outgoing state
+  bool changed  = (row->hl_state != state);
+  row->hl_state = state;
+  return changed;
+}
+
+/**
+ * findChunk - Find the last lexer state at or before a position
+ *
+ * Returns: Index of the state, -1 if there is none
+ */
+static int findChunk(const EditorHlChunks *chunks, int pos)
+{
+  int lo = 0;
+  int hi = chunks->count;
+  while (lo < hi)
+  {
+    int mid = (lo + hi) / 2;
+    if (chunks->data[mid].pos <= pos)
+      lo = mid + 1;
     else
+      hi = mid;
+  }
+  return lo - 1;
+}
+
+/**
+ * highlightRowEdit - Highlight a long row again around an edit
+ * @file: The file containing the row
+ * @row: The row, its highlighting moved along with the text
+ * @start: Position the highlighting is stale from
+ * @at: Position of the edit
+ * @removed: Bytes removed at @at
+ * @inserted: Bytes inserted at @at
+ * @changed: Set to true if the outgoing lexer state of the row changed
+ *
+ * Continues from the last lexer state before the edit, and stops at the
+ * first state after it that matches the state from before the edit. The
+ * states after that one are moved along with the text.
+ *
+ * Returns: false if the row has no lexer states to continue from
+ */
+static bool highlightRowEdit(EditorFile *file, EditorRow *row, int start, int at, int removed,
+                             int inserted, bool *changed)
+{
+  EditorHlChunks *old       = row->hl_chunks;
+  EditorSyntax   *s         = file->syntax;
+  int             row_index = (int) (row - file->row);
+  EditorHlState   state     = (row_index > 0) ? file->row[row_index - 1].hl_state : 0;
+
+  if (!old || !s || !s->loaded || old->from != state)
+    return false;
+
+  // Delimiters that must start a row depend on the indent, which an edit
+  // before it moves
+  int indent = rowIndent(row);
+  if (at <= indent)
+    return false;
+
+  // Restart before the edit and the lookahead of the tokens before it,
+  // where no embed is waiting for its text to start
+  int limit   = (start < at - HL_LOOKAHEAD) ? start : at - HL_LOOKAHEAD;
+  int restart = findChunk(old, (limit < 0) ? 0 : limit);
+  while (restart > 0 && old->data[restart].lexer.span.embed_at >= 0)
+  {
+    restart--;
+  }
+  if (restart < 0)
+    return false;
+
+  // States before the edit and its lookahead may not match
+  HlRun run     = {0};
+  run.old       = old->data;
+  run.old_count = old->count;
+  run.old_at    = findChunk(old, at + removed + HL_LOOKAHEAD - 1) + 1;
+  run.delta     = inserted - removed;
+  run.next      = old->data[restart].pos;
+  run.record_at = old->data[restart].pos;
+
+  HlLexer lexer = old->data[restart].lexer;
+  highlightLexer(s, row, old->data[restart].pos, indent, &lexer, &run);
+
+  // Splice the recorded states between the ones around the edit
+  int             recorded = run.chunks ? run.chunks->count : 0;
+  int             tail     = run.stopped ? old->count - run.old_at : 0;
+  int             count    = restart + recorded + tail;
+  EditorHlChunks *chunks   = malloc_s(sizeof(EditorHlChunks) + sizeof(EditorHlChunk) * count);
+
+  chunks->from     = state;
+  chunks->count    = count;
+  chunks->capacity = count;
+  memcpy(chunks->data, old->data, sizeof(EditorHlChunk) * restart);
+  if (recorded)
+    memcpy(&chunks->data[restart], run.chunks->data, sizeof(EditorHlChunk) * recorded);
+  for (int i = 0; i < tail; i++)
+  {
+    EditorHlChunk *chunk = &chunks->data[restart + recorded + i];
+    *chunk               = old->data[run.old_at + i];
+    chunk->pos += run.delta;
+    if (chunk->lexer.span.embed_at >= 0)
+      chunk->lexer.span.embed_at += run.delta;
+  }
+
+  free(run.chunks);
+  free(old);
+  row->hl_chunks = chunks;
+
+  // The rest of the row is unchanged when the lexer stopped
+  *changed = false;
+  if (!run.stopped)
+  {
+    state         = lexerState(&lexer);
+    *changed      = (row->hl_state != state);
+    row->hl_state = state;
+  }
+
+  markTrailing(row);
+  return true;
+}
+
+/**
+ * editorUpdateSyntax - Update syntax highlighting for a single row
+ * @file: The file containing the row
+ * @row: The row to update highlighting for
+ *
+ * Highlights the row, then the following rows as long as the outgoing
+ * state of the previous one changed. Rows after the first one whose
+ * state matches its cached value are still valid.
+ */
+void editorUpdateSyntax(EditorFile *file, EditorRow *row)
+{
+  int index = (int) (row - file->row);
+  while (highlightRow(file, &file->row[index]) && index + 1 < file->num_rows)
+  {
+    index++;
+  }
+}
+
+void editorUpdateSyntaxEdit(EditorFile *file, EditorRow *row, int at, int removed, int inserted)
+{
+  // Move the highlighting after the edit along with the text
+  memmove(&row->hl[at + inserted], &row->hl[at + removed], row->size - at - inserted);
+
+  // Whitespace before the edit may not trail anymore
+  int start = at;
+  while (start > 0 && row->hl[start - 1] == HL_TRAILING)
+  {
+    start--;
+  }
+
+  if (!CONVAR_GETINT(syntax) || !file->syntax || (file->largefile & LARGEFILE_SYNTAX))
+  {
+    memset(&row->hl[start], HL_NORMAL, at + inserted - start);
+    markTrailing(row);
+    return;
+  }
+
+  bool changed;
+  if (!highlightRowEdit(file, row, start, at, removed, inserted, &changed))
+    changed = highlightRow(file, row);
+
+  int index = (int) (row - file->row);
+  while (changed && index + 1 < file->num_rows)
+  {
+    changed = highlightRow(file, &file->row[++index]);
+  }
+}
+
+/**
+ * editorSetSyntaxHighlight - Set syntax highlighting for a file
+ * @file: The file to set syntax for
+ * @syntax: The syntax definition to use
+ * 
+ * Sets the syntax definition for a file and updates highlighting
+ * for all rows in the file.
+ */
+void editorSetSyntaxHighlight(EditorFile *file, EditorSyntax *syntax)
+{
+  file->syntax = syntax;
+  for (int i = 0; i < file->num_rows; i++)
+  {
+    highlightRow(file, &file->row[i]);
+  }
+}
+
+// Arena size for JSON parsing (4KB)
+#define ARENA_SIZE (1 << 12)
+
+/**
+ * struct HLDBIndexEntry - Extension or filename pattern of a syntax
+ * @ext: Extension (".c") or filename pattern ("Makefile")
+ * @syntax: Syntax that claims it
+ */
+typedef struct HLDBIndexEntry
+{
+  const char   *ext;
+  EditorSyntax *syntax;
+} HLDBIndexEntry;
+
+// Open addressing hash table of extensions, capacity is a power of two
+static HLDBIndexEntry *hldb_index;
+static size_t          hldb_index_capacity;
+
+// Filename patterns, in priority order
+static VECTOR(HLDBIndexEntry) hldb_patterns;
+
+// Modification time of the user syntax directory when it was last listed
+static int64_t hldb_dir_mtime;
+
+// Syntax definitions by id, NULL once removed
+static VECTOR(EditorSyntax *) hldb_ids;
+
+/**
+ * editorRegisterSyntax - Give a new syntax definition its id
+ */
+static void editorRegisterSyntax(EditorSyntax *syntax)
+{
+  syntax->id = hldb_ids.size;
+  vector_push(hldb_ids, syntax);
+}
+
+static EditorSyntax *editorGetSyntaxById(uint32_t id)
+{
+  return id < hldb_ids.size ? hldb_ids.data[id] : NULL;
+}
+
+static uint32_t hashExtension(const char *ext)
+{
+  // Case-insensitive FNV-1a
+  uint32_t hash = 2166136261u;
+  for (; *ext; ext++)
+  {
+    hash ^= (uint8_t) tolower((uint8_t) *ext);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+/**
+ * editorBuildHLDBIndex - Rebuild the extension index from the HLDB
+ *
+ * Assigns each syntax its priority (position in the HLDB) and indexes
+ * its extensions. When several syntax definitions claim the same
+ * extension, the one with the highest priority keeps it.
+ */
+static void editorBuildHLDBIndex(void)
+{
+  size_t count = 0;
+  int    priority = 0;
+  for (EditorSyntax *s = gEditor.HLDB; s; s = s->next)
+  {
+    s->priority = priority++;
+    count += s->file_exts.size;
+  }
+
+  size_t capacity = 16;
+  while (capacity < count * 2)
+    capacity *= 2;
+
+  free(hldb_index);
+  hldb_index          = calloc_s(capacity, sizeof(HLDBIndexEntry));
+  hldb_index_capacity = capacity;
+  hldb_patterns.size  = 0;
+
+  for (EditorSyntax *s = gEditor.HLDB; s; s = s->next)
+  {
+    for (size_t i = 0; i < s->file_exts.size; i++)
     {
-      break;
+      HLDBIndexEntry entry = {s->file_exts.data[i], s};
+      if (entry.ext[0] != '.')
+      {
+        vector_push(hldb_patterns, entry);
+        continue;
+      }
+
+      size_t slot = hashExtension(entry.ext) & (capacity - 1);
+      while (hldb_index[slot].ext && strCaseCmp(hldb_index[slot].ext, entry.ext) != 0)
+      {
+        slot = (slot + 1) & (capacity - 1);
+      }
+
+      // The first definition in priority order wins
+      if (!hldb_index[slot].ext)
+        hldb_index[slot] = entry;
     }
   }
 }
 
 /**
- * editorSetSyntaxHighlight - Set syntax highlighting for a file
- * @file: The file to set syntax for
- * @syntax: The syntax definition to use
- * 
- * Sets the syntax definition for a file and updates highlighting
- * for all rows in the file.
+ * editorFindSyntax - Find the syntax for a filename
+ * @filename: Name of the file
+ *
+ * Looks up the extension in the index, then checks the filename
+ * patterns that have a higher priority than the extension match.
+ *
+ * Returns: The matching syntax, or NULL if none matches
  */
-void editorSetSyntaxHighlight(EditorFile *file, EditorSyntax *syntax)
+static EditorSyntax *editorFindSyntax(const char *filename)
 {
-  file->syntax = syntax;
-  for (int i = 0; i < file->num_rows; i++)
+  EditorSyntax *found = NULL;
+
+  // Get file extension
+  const char *ext = strrchr(filename, '.');
+  if (ext && hldb_index_capacity)
+  {
+    size_t slot = hashExtension(ext) & (hldb_index_capacity - 1);
+    while (hldb_index[slot].ext)
+    {
+      if (strCaseCmp(hldb_index[slot].ext, ext) == 0)
+      {
+        found = hldb_index[slot].syntax;
+        break;
+      }
+      slot = (slot + 1) & (hldb_index_capacity - 1);
+    }
+  }
+
+  for (size_t i = 0; i < hldb_patterns.size; i++)
   {
-    editorUpdateSyntax(file, &file->row[i]);
+    HLDBIndexEntry *entry = &hldb_patterns.data[i];
+    if (found && entry->syntax->priority >= found->priority)
+      break;
+
+    if (strCaseStr(filename, entry->ext))
+      return entry->syntax;
   }
+  return found;
 }
 
 /**
@@ -300,8 +1311,7 @@ void editorSetSyntaxHighlight(EditorFile *file, EditorSyntax *syntax)
  * @file: The file to detect syntax for
  * 
  * Automatically selects appropriate syntax highlighting based on
- * the file's extension or filename pattern. Searches through all
- * registered syntax definitions in HLDB.
+ * the file's extension or filename pattern.
  */
 void editorSelectSyntaxHighlight(EditorFile *file)
 {
@@ -309,49 +1319,51 @@ void editorSelectSyntaxHighlight(EditorFile *file)
   if (file->filename == NULL)
     return;
 
-  // Get file extension
-  char *ext = strrchr(file->filename, '.');
+  EditorSyntax *s = editorFindSyntax(file->filename);
+  if (s)
+    editorSetSyntaxHighlight(file, s);
+}
 
-  // Search through all syntax definitions
+/**
+ * editorFindSyntaxByName - Find a syntax by language name or extension
+ * @name: Language name or extension without the dot
+ *
+ * Returns: The first matching syntax in priority order, or NULL
+ */
+EditorSyntax *editorFindSyntaxByName(const char *name)
+{
   for (EditorSyntax *s = gEditor.HLDB; s; s = s->next)
   {
+    // Match the language name or the extension
+    if (strCaseCmp(name, s->file_type) == 0)
+      return s;
+
     for (size_t i = 0; i < s->file_exts.size; i++)
     {
       int is_ext = (s->file_exts.data[i][0] == '.');
-      
-      // Match by extension or filename pattern
-      if ((is_ext && ext && strCaseCmp(ext, s->file_exts.data[i]) == 0) ||
-          (!is_ext && strCaseStr(file->filename, s->file_exts.data[i])))
-      {
-        editorSetSyntaxHighlight(file, s);
-        return;
-      }
+      if ((is_ext && strCaseCmp(name, &s->file_exts.data[i][1]) == 0) ||
+          (!is_ext && strCaseStr(name, s->file_exts.data[i])))
+        return s;
     }
   }
+  return NULL;
 }
 
-// Arena size for JSON parsing (4KB)
-#define ARENA_SIZE (1 << 12)
-
-// Memory arena for syntax definition parsing
-static JsonArena hldb_arena;
-
 static void loadEditorConfigHLDB(void);
 static void editorLoadBundledHLDB(void);
+static void editorLoadUserHLDB(const char *path);
+static bool editorAddSyntaxFile(const char *path);
 
 /**
  * editorInitHLDB - Initialize the syntax highlighting database
  * 
- * Loads all syntax definitions from:
+ * Registers all syntax definitions from:
  * 1. Built-in editor config syntax
  * 2. Bundled syntax files (compiled into binary)
  * 3. User syntax files from ~/.config/lex/syntax/ (*.json files)
  */
 void editorInitHLDB(void)
 {
-  // Initialize JSON parsing arena
-  json_arena_init(&hldb_arena, ARENA_SIZE);
-
   // Load built-in and bundled syntax definitions
   loadEditorConfigHLDB();
   editorLoadBundledHLDB();
@@ -360,6 +1372,24 @@ void editorInitHLDB(void)
   char path[EDITOR_PATH_MAX];
   snprintf(path, sizeof(path), PATH_CAT("%s", CONF_DIR, "syntax"), getenv(ENV_HOME));
 
+  FileInfo dir_info = getFileInfo(path);
+  hldb_dir_mtime    = dir_info.error ? 0 : getFileModTime(dir_info);
+  if (!dir_info.error)
+    editorLoadUserHLDB(path);
+
+  editorBuildHLDBIndex();
+}
+
+/**
+ * editorLoadUserHLDB - Load the syntax files of a directory
+ * @path: The user syntax directory
+ *
+ * Loads every .json file that is not already in the HLDB. Entries are
+ * filtered by name only; anything that is not a readable file simply
+ * fails to open.
+ */
+static void editorLoadUserHLDB(const char *path)
+{
   DirIter iter = dirFindFirst(path);
   if (iter.error)
     return;
@@ -375,14 +1405,22 @@ void editorInitHLDB(void)
       continue;
 
     // Only load .json files
-    if (getFileType(file_path) == FT_REG)
+    const char *ext = strrchr(filename, '.');
+    if (!ext || strcmp(ext, ".json") != 0)
+      continue;
+
+    bool known = false;
+    for (EditorSyntax *s = gEditor.HLDB; s; s = s->next)
     {
-      const char *ext = strrchr(filename, '.');
-      if (ext && strcmp(ext, ".json") == 0)
+      if (s->path && strcmp(s->path, file_path) == 0)
       {
-        editorLoadHLDB(file_path);
+        known = true;
+        break;
       }
     }
+
+    if (!known)
+      editorAddSyntaxFile(file_path);
   } while (dirNext(&iter));
   dirClose(&iter);
 }
@@ -420,7 +1458,9 @@ static void loadEditorConfigHLDB(void)
     vector_push(syntax->keywords[2], color_element_map[i].label);
   }
 
-  syntax->flags = HL_HIGHLIGHT_STRINGS;
+  syntax->flags  = HL_HIGHLIGHT_STRINGS;
+  syntax->loaded = true;
+  editorRegisterSyntax(syntax);
 
   // Add to beginning of HLDB linked list
   syntax->next = gEditor.HLDB;
@@ -428,24 +1468,14 @@ static void loadEditorConfigHLDB(void)
 }
 
 /**
- * editorLoadJsonHLDB - Parse and load a syntax definition from JSON
- * @json: JSON string containing syntax definition
- * @syntax: Syntax structure to populate
- * 
- * Parses a JSON syntax definition file and populates the EditorSyntax
- * structure. The JSON format includes:
- * - name: Display name for the language
- * - extensions: Array of file extensions/patterns
- * - comment: Single-line comment delimiter
- * - multiline-comment: Array of [start, end] delimiters
- * - keywords1, keywords2, keywords3: Keyword arrays
- * 
+ * editorLoadJsonHeader - Parse the name and extensions of a syntax
+ * @syntax: Syntax structure with a parsed JSON value
+ *
  * Returns: true if parsing succeeded, false otherwise
  */
-static bool editorLoadJsonHLDB(const char *json, EditorSyntax *syntax)
+static bool editorLoadJsonHeader(EditorSyntax *syntax)
 {
-  // Parse JSON string
-  JsonValue *value = json_parse(json, &hldb_arena);
+  JsonValue *value = syntax->value;
   if (value->type != JSON_OBJECT)
   {
     return false;
@@ -477,6 +1507,52 @@ static bool editorLoadJsonHLDB(const char *json, EditorSyntax *syntax)
   }
   vector_shrink(syntax->file_exts);
 
+  return true;
+}
+
+/**
+ * parseHighlightType - Parse the "type" of a region or an embed
+ * @type: The JSON value, NULL keeps the default
+ * @hl: Set to the foreground highlight
+ *
+ * Returns: true if the type is valid
+ */
+static bool parseHighlightType(const JsonValue *type, uint8_t *hl)
+{
+  if (!type || type->type == JSON_NULL)
+    return true;
+  if (type->type != JSON_STRING)
+    return false;
+
+  const char *names[] = {"normal", "comment", "keyword1", "keyword2", "keyword3", "string"};
+  for (int i = 0; i < (int) (sizeof(names) / sizeof(names[0])); i++)
+  {
+    if (strcmp(type->string, names[i]) == 0)
+    {
+      *hl = HL_NORMAL + i;
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * editorLoadJsonBody - Parse the highlighting rules of a syntax
+ * @syntax: Syntax structure with a parsed JSON value
+ * 
+ * Parses the rest of a JSON syntax definition. The JSON format includes:
+ * - comment: Single-line comment delimiter
+ * - multiline-comment: Array of [start, end] delimiters
+ * - regions: Array of constructs spanning several rows
+ * - embeds: Array of regions highlighted with another syntax
+ * - keywords1, keywords2, keywords3: Keyword arrays
+ * 
+ * Returns: true if parsing succeeded, false otherwise
+ */
+static bool editorLoadJsonBody(EditorSyntax *syntax)
+{
+  JsonObject *object = syntax->value->object;
+
   // Parse single-line comment delimiter (optional)
   JsonValue *comment = json_object_find(object, "comment");
   if (comment && comment->type != JSON_NULL)
@@ -505,12 +1581,115 @@ static bool editorLoadJsonHLDB(const char *json, EditorSyntax *syntax)
     JsonValue *mce = multi_comment->array->data[1];
     CHECK(mce && mce->type == JSON_STRING);
     syntax->multiline_comment_end = mce->string;
+
+    CHECK(mcs->string[0] && mce->string[0]);
+    EditorSyntaxRegion region = {mcs->string, mce->string, 0, HL_COMMENT, 0};
+    vector_push(syntax->regions, region);
   }
   else
   {
     syntax->multiline_comment_start = NULL;
     syntax->multiline_comment_end   = NULL;
   }
+
+  // Parse regions (optional)
+  JsonValue *regions = json_object_find(object, "regions");
+  if (regions && regions->type != JSON_NULL)
+  {
+    CHECK(regions->type == JSON_ARRAY);
+    for (size_t i = 0; i < regions->array->size; i++)
+    {
+      JsonValue *item = regions->array->data[i];
+      CHECK(item->type == JSON_OBJECT);
+
+      EditorSyntaxRegion region = {0};
+      region.hl                 = HL_STRING;
+
+      JsonValue *start = json_object_find(item->object, "start");
+      CHECK(start && start->type == JSON_STRING && start->string[0]);
+      region.start = start->string;
+
+      const char *bool_fields[] = {"escape", "nested", "line-start", "heredoc"};
+      for (int j = 0; j < 4; j++)
+      {
+        JsonValue *flag = json_object_find(item->object, bool_fields[j]);
+        if (flag)
+        {
+          CHECK(flag->type == JSON_BOOLEAN);
+          if (flag->boolean)
+            region.flags |= 1 << j;
+        }
+      }
+
+      JsonValue *end = json_object_find(item->object, "end");
+      if (region.flags & HL_REGION_HEREDOC)
+      {
+        region.end = "";
+      }
+      else
+      {
+        CHECK(end && end->type == JSON_STRING && end->string[0]);
+        region.end = end->string;
+      }
+
+      JsonValue *fence = json_object_find(item->object, "fence");
+      if (fence && fence->type != JSON_NULL)
+      {
+        CHECK(fence->type == JSON_STRING && strlen(fence->string) == 1);
+        CHECK(strchr(region.start, fence->string[0]));
+        region.fence = fence->string[0];
+      }
+
+      CHECK(parseHighlightType(json_object_find(item->object, "type"), &region.hl));
+
+      vector_push(syntax->regions, region);
+    }
+  }
+
+  // Parse embedded syntax regions (optional)
+  JsonValue *embeds = json_object_find(object, "embeds");
+  if (embeds && embeds->type != JSON_NULL)
+  {
+    CHECK(embeds->type == JSON_ARRAY);
+    for (size_t i = 0; i < embeds->array->size; i++)
+    {
+      JsonValue *item = embeds->array->data[i];
+      CHECK(item->type == JSON_OBJECT);
+
+      EditorSyntaxEmbed embed = {0};
+      embed.hl                = HL_NORMAL;
+
+      const char *bool_fields[] = {"info", "line-start"};
+      for (int j = 0; j < 2; j++)
+      {
+        JsonValue *flag = json_object_find(item->object, bool_fields[j]);
+        if (flag)
+        {
+          CHECK(flag->type == JSON_BOOLEAN);
+          if (flag->boolean)
+            embed.flags |= 1 << j;
+        }
+      }
+
+      const char **str_fields[] = {&embed.start, &embed.end, &embed.open, &embed.syntax};
+      const char  *str_names[]  = {"start", "end", "open", "syntax"};
+      for (int j = 0; j < 4; j++)
+      {
+        JsonValue *str = json_object_find(item->object, str_names[j]);
+        if (str && str->type != JSON_NULL)
+        {
+          CHECK(str->type == JSON_STRING && str->string[0]);
+          *str_fields[j] = str->string;
+        }
+      }
+      CHECK(embed.start && embed.end);
+      CHECK(embed.syntax || (embed.flags & HL_EMBED_INFO));
+
+      CHECK(parseHighlightType(json_object_find(item->object, "type"), &embed.hl));
+
+      vector_push(syntax->embeds, embed);
+    }
+  }
   
   // Parse keyword arrays (3 categories)
   const char *kw_fields[] = {"keywords1", "keywords2", "keywords3"};
@@ -538,60 +1717,96 @@ static bool editorLoadJsonHLDB(const char *json, EditorSyntax *syntax)
 }
 
 /**
- * editorLoadBundledHLDB - Load all bundled syntax definitions
+ * editorLoadSyntax - Parse the body of a syntax on first use
+ * @syntax: The syntax to load
+ *
+ * Bundled definitions are parsed from the embedded JSON text here; user
+ * definitions were already parsed when their header was read. If the
+ * definition is invalid, the syntax stays loaded without any rules.
+ */
+static void editorLoadSyntax(EditorSyntax *syntax)
+{
+  syntax->loaded = true;
+
+  if (!syntax->value)
+  {
+    json_arena_init(&syntax->arena, ARENA_SIZE);
+    syntax->value = json_parse(syntax->source, &syntax->arena);
+  }
+
+  if (syntax->value->type != JSON_OBJECT || !editorLoadJsonBody(syntax))
+  {
+    for (size_t i = 0; i < sizeof(syntax->keywords) / sizeof(syntax->keywords[0]); i++)
+    {
+      syntax->keywords[i].size = 0;
+    }
+    syntax->regions.size             = 0;
+    syntax->embeds.size              = 0;
+    syntax->singleline_comment_start = NULL;
+    syntax->multiline_comment_start  = NULL;
+    syntax->multiline_comment_end    = NULL;
+    syntax->flags                    = 0;
+    editorMsg("Failed to load syntax \"%s\"", syntax->file_type);
+  }
+}
+
+/**
+ * editorLoadBundledHLDB - Register all bundled syntax definitions
  * 
- * Loads syntax definitions that are compiled into the binary
- * from the resources/bundle.h file. These are the default
- * syntax definitions for common languages.
+ * Registers syntax definitions that are compiled into the binary
+ * from the resources/bundle.h file. The names and extensions come
+ * from metadata generated by the bundler, the JSON text itself is
+ * parsed on first use.
  */
 static void editorLoadBundledHLDB(void)
 {
   for (size_t i = 0; i < sizeof(bundle) / sizeof(bundle[0]); i++)
   {
     EditorSyntax *syntax = calloc_s(1, sizeof(EditorSyntax));
-    if (editorLoadJsonHLDB(bundle[i], syntax))
-    {
-      // Add to HLDB linked list
-      syntax->next = gEditor.HLDB;
-      gEditor.HLDB = syntax;
-    }
-    else
+
+    syntax->file_type = bundle_name[i];
+    syntax->source    = bundle[i];
+    for (const char **ext = bundle_exts[i]; *ext; ext++)
     {
-      // Failed to parse, free the allocation
-      free(syntax);
+      vector_push(syntax->file_exts, *ext);
     }
+    editorRegisterSyntax(syntax);
+
+    // Add to HLDB linked list
+    syntax->next = gEditor.HLDB;
+    gEditor.HLDB = syntax;
   }
 }
 
 /**
- * editorLoadHLDB - Load a syntax definition from a file
- * @path: Path to JSON syntax definition file
- * 
- * Loads and parses a syntax definition from a JSON file on disk.
- * Used to load user-defined syntax files from ~/.config/lex/syntax/
- * 
- * Returns: true if loading succeeded, false otherwise
+ * editorReadSyntaxFile - Read and parse the header of a syntax file
+ * @syntax: Syntax structure with @path set
+ *
+ * Returns: true if the file was read and has a valid header
  */
-bool editorLoadHLDB(const char *path)
+static bool editorReadSyntaxFile(EditorSyntax *syntax)
 {
-  FILE  *fp;
-  size_t size;
-  char  *buffer;
+  FileInfo info = getFileInfo(syntax->path);
+  if (info.error)
+    return false;
+
+  syntax->mtime     = getFileModTime(info);
+  syntax->file_size = getFileSize(info);
 
   // Open and read file
-  fp = openFile(path, "rb");
+  FILE *fp = openFile(syntax->path, "rb");
   if (!fp)
     return false;
 
   // Get file size
   fseek(fp, 0, SEEK_END);
-  size = ftell(fp);
+  size_t size = ftell(fp);
   fseek(fp, 0, SEEK_SET);
 
   // Allocate buffer and read file
-  buffer = calloc_s(1, size + 1);
+  char *buffer = calloc_s(1, size + 1);
 
-  if (fread(buffer, size, 1, fp) != 1)
+  if (size > 0 && fread(buffer, size, 1, fp) != 1)
   {
     fclose(fp);
     free(buffer);
@@ -599,29 +1814,203 @@ bool editorLoadHLDB(const char *path)
   }
   fclose(fp);
 
-  // Parse JSON and add to HLDB
-  EditorSyntax *syntax = calloc_s(1, sizeof(EditorSyntax));
-  if (editorLoadJsonHLDB(buffer, syntax))
+  // Parse JSON, the parsed value is kept for the body
+  json_arena_init(&syntax->arena, ARENA_SIZE);
+  syntax->value = json_parse(buffer, &syntax->arena);
+  free(buffer);
+
+  return editorLoadJsonHeader(syntax);
+}
+
+/**
+ * editorClearSyntax - Free everything parsed from a syntax definition
+ * @syntax: The syntax to clear
+ *
+ * Keeps the list link and the path so the definition can be read again.
+ */
+static void editorClearSyntax(EditorSyntax *syntax)
+{
+  // Free file extensions array
+  free(syntax->file_exts.data);
+  
+  // Free all keyword arrays
+  for (size_t i = 0; i < sizeof(syntax->keywords) / sizeof(syntax->keywords[0]); i++)
   {
-    // Add to HLDB linked list
-    syntax->next = gEditor.HLDB;
-    gEditor.HLDB = syntax;
+    free(syntax->keywords[i].data);
   }
-  else
+  free(syntax->regions.data);
+  free(syntax->embeds.data);
+  
+  // Free JSON parsing arena
+  json_arena_deinit(&syntax->arena);
+
+  EditorSyntax *next = syntax->next;
+  char         *path = syntax->path;
+  int           id   = syntax->id;
+  memset(syntax, 0, sizeof(EditorSyntax));
+  syntax->next = next;
+  syntax->path = path;
+  syntax->id   = id;
+}
+
+/**
+ * editorAddSyntaxFile - Add a syntax definition file to the HLDB
+ * @path: Path to JSON syntax definition file
+ *
+ * Returns: true if the file was read and has a valid header
+ */
+static bool editorAddSyntaxFile(const char *path)
+{
+  EditorSyntax *syntax = calloc_s(1, sizeof(EditorSyntax));
+
+  int len      = strlen(path);
+  syntax->path = malloc_s(len + 1);
+  snprintf(syntax->path, len + 1, "%s", path);
+
+  if (!editorReadSyntaxFile(syntax))
   {
-    // Failed to parse
+    // Failed to read or parse
+    editorClearSyntax(syntax);
+    free(syntax->path);
     free(syntax);
+    return false;
   }
 
-  free(buffer);
+  // Add to HLDB linked list
+  syntax->next = gEditor.HLDB;
+  gEditor.HLDB = syntax;
+  editorRegisterSyntax(syntax);
+  return true;
+}
+
+/**
+ * editorLoadHLDB - Load a syntax definition from a file
+ * @path: Path to JSON syntax definition file
+ * 
+ * Loads the name and extensions of a syntax definition from a JSON
+ * file on disk and adds it to the extension index. Used to load
+ * user-defined syntax files from ~/.config/lex/syntax/
+ * 
+ * Returns: true if loading succeeded, false otherwise
+ */
+bool editorLoadHLDB(const char *path)
+{
+  if (!editorAddSyntaxFile(path))
+    return false;
+
+  editorBuildHLDBIndex();
   return true;
 }
 
+/**
+ * editorReloadHLDB - Reload syntax definitions that changed on disk
+ *
+ * Compares the modification time and size of every syntax file with the
+ * values seen when it was loaded, and lists the user syntax directory
+ * again only if the directory itself changed.
+ */
+void editorReloadHLDB(void)
+{
+  bool reselect[EDITOR_FILE_MAX_SLOT] = {0};
+  bool changed                        = false;
+
+  // Check the definitions loaded from files
+  EditorSyntax **link = &gEditor.HLDB;
+  while (*link)
+  {
+    EditorSyntax *s = *link;
+    if (!s->path)
+    {
+      link = &s->next;
+      continue;
+    }
+
+    FileInfo info = getFileInfo(s->path);
+    if (!info.error && getFileModTime(info) == s->mtime && getFileSize(info) == s->file_size)
+    {
+      link = &s->next;
+      continue;
+    }
+
+    // Files using the syntax have to select it again
+    for (int i = 0; i < gEditor.file_count; i++)
+    {
+      if (gEditor.files[i].syntax == s)
+      {
+        gEditor.files[i].syntax = NULL;
+        reselect[i]             = true;
+      }
+    }
+    changed = true;
+
+    editorClearSyntax(s);
+    if (!info.error && editorReadSyntaxFile(s))
+    {
+      link = &s->next;
+      continue;
+    }
+
+    // Removed or invalid
+    *link                 = s->next;
+    hldb_ids.data[s->id] = NULL;
+    editorClearSyntax(s);
+    free(s->path);
+    free(s);
+  }
+
+  // List the user syntax directory only if its content changed
+  char path[EDITOR_PATH_MAX];
+  snprintf(path, sizeof(path), PATH_CAT("%s", CONF_DIR, "syntax"), getenv(ENV_HOME));
+
+  EditorSyntax *old_head = gEditor.HLDB;
+  FileInfo      dir_info = getFileInfo(path);
+  int64_t       mtime    = dir_info.error ? 0 : getFileModTime(dir_info);
+  if (mtime != hldb_dir_mtime)
+  {
+    hldb_dir_mtime = mtime;
+    if (!dir_info.error)
+      editorLoadUserHLDB(path);
+  }
+
+  // New definitions are prepended to the list
+  bool added = (gEditor.HLDB != old_head);
+  if (!changed && !added)
+    return;
+
+  editorBuildHLDBIndex();
+
+  for (int i = 0; i < gEditor.file_count; i++)
+  {
+    EditorFile *file = &gEditor.files[i];
+    if (!file->filename)
+      continue;
+
+    if (reselect[i])
+    {
+      EditorSyntax *s = editorFindSyntax(file->filename);
+      editorSetSyntaxHighlight(file, s);
+    }
+    else if (added)
+    {
+      // Only switch to a newly added definition
+      EditorSyntax *s = editorFindSyntax(file->filename);
+      for (EditorSyntax *curr = gEditor.HLDB; curr && curr != old_head; curr = curr->next)
+      {
+        if (s == curr && s != file->syntax)
+        {
+          editorSetSyntaxHighlight(file, s);
+          break;
+        }
+      }
+    }
+  }
+}
+
 /**
  * editorFreeHLDB - Free all syntax highlighting definitions
  * 
  * Frees all memory used by the syntax highlighting database,
- * including all syntax definitions and the JSON parsing arena.
+ * including all syntax definitions and the extension index.
  * Called on editor shutdown.
  */
 void editorFreeHLDB(void)
@@ -633,20 +2022,20 @@ void editorFreeHLDB(void)
   {
     EditorSyntax *temp = HLDB;
     HLDB               = HLDB->next;
-    
-    // Free file extensions array
-    free(temp->file_exts.data);
-    
-    // Free all keyword arrays
-    for (size_t i = 0; i < sizeof(temp->keywords) / sizeof(temp->keywords[0]); i++)
-    {
-      free(temp->keywords[i].data);
-    }
-    
+
+    editorClearSyntax(temp);
+    free(temp->path);
     free(temp);
   }
   
-  // Free JSON parsing arena
-  json_arena_deinit(&hldb_arena);
+  // Free extension index
+  free(hldb_index);
+  free(hldb_patterns.data);
+  free(hldb_ids.data);
+  memset(&hldb_ids, 0, sizeof(hldb_ids));
+  hldb_index          = NULL;
+  hldb_index_capacity = 0;
+  memset(&hldb_patterns, 0, sizeof(hldb_patterns));
+
   gEditor.HLDB = NULL;
-}
\ No newline at end of file
+}
@@ -1,6 +1,7 @@
 #ifndef HIGHLIGHT_H
 #define HIGHLIGHT_H
 
+#include "json.h"
 #include "utils.h"
 
 // Forward declarations to avoid circular dependencies
@@ -82,6 +83,106 @@ enum EditorHighlightBg
   HL_BG_COUNT,  // Count of background types
 };
 
+/**
+ * Region flags
+ *
+ * @HL_REGION_ESCAPE: A backslash escapes the next character
+ * @HL_REGION_NESTED: The start delimiter nests inside the region
+ * @HL_REGION_LINE_START: Delimiters only match as the first non-blank text of a row
+ * @HL_REGION_HEREDOC: The word after the start is the delimiter that ends
+ *                     the region on a row of its own, starting from the next row
+ */
+#define HL_REGION_ESCAPE (1 << 0)
+#define HL_REGION_NESTED (1 << 1)
+#define HL_REGION_LINE_START (1 << 2)
+#define HL_REGION_HEREDOC (1 << 3)
+
+/**
+ * struct EditorSyntaxRegion - Construct that can span several rows
+ * @start: Start delimiter
+ * @end: End delimiter (unused for heredocs)
+ * @fence: Character of the start delimiter that may repeat, the end
+ *         delimiter must repeat it the same number of times (raw strings)
+ * @hl: Foreground highlight of the region (HL_COMMENT or HL_STRING)
+ * @flags: HL_REGION_* flags
+ *
+ * Multi-line comments, triple-quoted and raw strings, heredocs and fenced
+ * code blocks are all regions. Only the region a row ends in is carried
+ * to the next row, see EditorHlState.
+ */
+typedef struct EditorSyntaxRegion
+{
+  const char *start;
+  const char *end;
+  char        fence;
+  uint8_t     hl;
+  int         flags;
+} EditorSyntaxRegion;
+
+/**
+ * Embed flags
+ *
+ * @HL_EMBED_INFO: The language is named by the word after the start
+ *                 delimiter, the embedded text starts on the next row
+ * @HL_EMBED_LINE_START: Delimiters only match as the first non-blank text of a row
+ */
+#define HL_EMBED_INFO (1 << 0)
+#define HL_EMBED_LINE_START (1 << 1)
+
+/**
+ * struct EditorSyntaxEmbed - Region highlighted with another syntax
+ * @start: Start delimiter, matched case-insensitively
+ * @open: Text that ends the opening tag (e.g. ">"), or NULL if the
+ *        embedded text follows the start delimiter
+ * @end: End delimiter, matched case-insensitively
+ * @syntax: Name or extension of the embedded syntax, NULL for HL_EMBED_INFO
+ * @hl: Foreground highlight of the delimiters
+ * @flags: HL_EMBED_* flags
+ *
+ * Used for <script> and <style> in HTML and fenced code blocks in
+ * Markdown. Embedded syntax definitions do not embed further.
+ */
+typedef struct EditorSyntaxEmbed
+{
+  const char *start;
+  const char *open;
+  const char *end;
+  const char *syntax;
+  uint8_t     hl;
+  int         flags;
+} EditorSyntaxEmbed;
+
+/**
+ * Lexer frame - State of one syntax at the end of a row
+ *
+ * The low 8 bits hold the open region (index + 1, 0 if none), or
+ * HL_FRAME_EMBED plus the embed index. The upper 24 bits hold the
+ * argument: the nesting depth of a nested region, the fence count of a
+ * raw string, a hash of a heredoc delimiter, or the id of the embedded
+ * syntax.
+ */
+#define HL_FRAME_REGION(frame) ((int) ((frame) & 0xFF))
+#define HL_FRAME_ARG(frame) ((uint32_t) (frame) >> 8)
+#define HL_FRAME(region, arg) ((uint32_t) (region) | ((uint32_t) (arg) << 8))
+#define HL_FRAME_EMBED 0x80
+#define HL_FRAME_MAX_ARG 0xFFFFFF
+
+/**
+ * EditorHlState - Lexer state at the end of a row
+ *
+ * A stack of two frames: the low 32 bits belong to the syntax of the
+ * file, the high 32 bits to the embedded syntax while the outer frame is
+ * inside an embed.
+ *
+ * Each row caches its outgoing state. Rehighlighting a row continues to
+ * the next rows only until a row's outgoing state matches its cache.
+ */
+typedef uint64_t EditorHlState;
+
+#define HL_STATE_OUTER(state) ((uint32_t) (state))
+#define HL_STATE_INNER(state) ((uint32_t) ((state) >> 32))
+#define HL_STATE(outer, inner) ((EditorHlState) (outer) | ((EditorHlState) (inner) << 32))
+
 /**
  * struct EditorSyntax - Syntax highlighting definition for a language
  * @next: Pointer to next syntax in HLDB linked list
@@ -95,12 +196,25 @@ enum EditorHighlightBg
  *            - keywords[1]: Secondary keywords (types, modifiers)
  *            - keywords[2]: Tertiary keywords (built-ins, constants)
  * @flags: Feature flags (HL_HIGHLIGHT_NUMBERS | HL_HIGHLIGHT_STRINGS)
- * @value: Pointer to parsed JSON value (owned by JSON arena)
+ * @regions: Multi-row constructs, the multi-line comment comes first
+ * @embeds: Regions highlighted with another syntax
+ * @value: Pointer to parsed JSON value (owned by @arena)
+ * @priority: Position in the HLDB, a lower value wins when several match
+ * @id: Stable identifier, kept in the lexer state of embedded regions
+ * @loaded: True once the body (comments, keywords, flags) has been parsed
+ * @source: Bundled JSON text, NULL if the syntax comes from a file
+ * @path: JSON file the syntax was loaded from, NULL if bundled
+ * @mtime: Modification time of @path when it was loaded
+ * @file_size: Size of @path when it was loaded
+ * @arena: Memory arena holding the parsed JSON
  *
  * This structure defines how a particular programming language should
  * be syntax highlighted. Multiple EditorSyntax structures form a
  * linked list (HLDB) that the editor searches through when opening files.
  *
+ * Only the name and the extensions are known at startup. The rest of the
+ * definition is parsed the first time a file uses the syntax.
+ *
  * File extensions in file_exts can be either:
  * - Extensions starting with '.' (e.g., ".c", ".py")
  * - Filename patterns (e.g., "Makefile", "README")
@@ -116,8 +230,19 @@ typedef struct EditorSyntax
   VECTOR(const char *) file_exts;
   VECTOR(const char *) keywords[3];
   int flags;
+  VECTOR(EditorSyntaxRegion) regions;
+  VECTOR(EditorSyntaxEmbed) embeds;
 
   struct JsonValue *value;
+
+  int         priority;
+  int         id;
+  bool        loaded;
+  const char *source;
+  char       *path;
+  int64_t     mtime;
+  int64_t     file_size;
+  JsonArena   arena;
 } EditorSyntax;
 
 /**
@@ -126,13 +251,30 @@ typedef struct EditorSyntax
  * @row: The row to update
  *
  * Performs syntax highlighting on a single line based on the file's
- * syntax definition. This function is called:
+ * syntax definition, parsing the definition first if it has not been
+ * used yet. This function is called:
  * - When a line is modified
  * - When syntax is changed
- * - Recursively when multi-line comment state changes
+ *
+ * If the row's outgoing lexer state changes, the following rows are
+ * highlighted too until one ends in the same state as before.
  */
 void editorUpdateSyntax(EditorFile *file, EditorRow *row);
 
+/**
+ * editorUpdateSyntaxEdit - Update syntax highlighting after an edit of a long row
+ * @file: The file containing the row
+ * @row: The row, already edited
+ * @at: Position of the edit
+ * @removed: Bytes removed at @at
+ * @inserted: Bytes inserted at @at
+ *
+ * Same as editorUpdateSyntax, but only highlights the chunks of the row
+ * around the edit again when the row kept its lexer states, see
+ * editorRowIsLong().
+ */
+void editorUpdateSyntaxEdit(EditorFile *file, EditorRow *row, int at, int removed, int inserted);
+
 /**
  * editorSetSyntaxHighlight - Set syntax highlighting for a file
  * @file: The file to set syntax for
@@ -148,19 +290,31 @@ void editorSetSyntaxHighlight(EditorFile *file, EditorSyntax *syntax);
  * @file: The file to detect syntax for
  *
  * Automatically selects appropriate syntax highlighting based on
- * the file's extension or filename pattern by searching through
- * all registered syntax definitions in HLDB.
+ * the file's extension or filename pattern. Extensions are looked up
+ * in a hash index built from the HLDB, so the cost does not grow with
+ * the number of registered syntax definitions.
  */
 void editorSelectSyntaxHighlight(EditorFile *file);
 
+/**
+ * editorFindSyntaxByName - Find a syntax by language name or extension
+ * @name: Language name ("Python") or extension without the dot ("py")
+ *
+ * Returns: The syntax, or NULL if none matches
+ */
+EditorSyntax *editorFindSyntaxByName(const char *name);
+
 /**
  * editorInitHLDB - Initialize the syntax highlighting database
  *
- * Loads all syntax definitions from multiple sources:
+ * Registers all syntax definitions from multiple sources:
  * 1. Built-in editor config syntax
  * 2. Bundled syntax files (compiled into binary)
  * 3. User syntax files from ~/.config/lex/syntax/ directory
  *
+ * Bundled definitions are indexed from metadata generated by the
+ * bundler, so no JSON is parsed until a file needs it.
+ *
  * This function should be called once during editor initialization.
  */
 void editorInitHLDB(void);
@@ -178,6 +332,7 @@ void editorInitHLDB(void);
  *   "extensions": [".c", ".h"],
  *   "comment": "//",
  *   "multiline-comment": ["slash-star", "star-slash"],
+ *   "regions": [{"start": "R\"(", "end": ")\"", "type": "string"}],
  *   "keywords1": ["if", "else", "while", ...],
  *   "keywords2": ["int", "char", "void", ...],
  *   "keywords3": ["NULL", "true", "false", ...]
@@ -187,6 +342,17 @@ void editorInitHLDB(void);
  */
 bool editorLoadHLDB(const char *json_file);
 
+/**
+ * editorReloadHLDB - Reload syntax definitions that changed on disk
+ *
+ * Checks every syntax definition loaded from a file and re-reads the
+ * syntax directory only if its modification time changed. Definitions
+ * whose file changed are parsed again, removed files are dropped and
+ * new files are added. Only the open files affected by a change are
+ * highlighted again.
+ */
+void editorReloadHLDB(void);
+
 /**
  * editorFreeHLDB - Free all syntax highlighting definitions
  *
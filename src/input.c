@@ -3,6 +3,7 @@
 #include "config.h"
 #include "editor.h"
 #include "file_io.h"
+#include "finder.h"
 #include "output.h"
 #include "prompt.h"
 #include "select.h"
@@ -28,8 +29,7 @@ static void editorExplorerNodeClicked(void)
     return;
   if (node->is_directory)
   {
-    node->is_open ^= 1;
-    editorExplorerRefresh();
+    editorExplorerToggle(gEditor.explorer.selected_index);
   }
   else if (editorOpen(&file, node->filename))
   {
@@ -247,6 +247,23 @@ void editorScrollToCursor(void)
     rx = editorRowCxToRx(&gCurFile->row[gCurFile->cursor.y], gCurFile->cursor.x);
   }
 
+  // Wrap mode scrolls by screen lines and never horizontally
+  if (editorWrapReady(gCurFile))
+  {
+    int line = editorWrapLineOfRx(gCurFile, gCurFile->cursor.y, rx);
+    int top  = editorWrapTop(gCurFile);
+    if (line < top)
+    {
+      top = line;
+    }
+    if (line >= top + gEditor.display_rows)
+    {
+      top = line - gEditor.display_rows + 1;
+    }
+    editorWrapSetTop(gCurFile, top);
+    return;
+  }
+
   if (gCurFile->cursor.y < gCurFile->row_offset)
   {
     gCurFile->row_offset = gCurFile->cursor.y;
@@ -267,6 +284,14 @@ void editorScrollToCursor(void)
 
 void editorScrollToCursorCenter(void)
 {
+  if (editorWrapReady(gCurFile))
+  {
+    int rx = editorRowCxToRx(&gCurFile->row[gCurFile->cursor.y], gCurFile->cursor.x);
+    editorWrapSetTop(gCurFile, editorWrapLineOfRx(gCurFile, gCurFile->cursor.y, rx) -
+                                   gEditor.display_rows / 2);
+    return;
+  }
+
   gCurFile->row_offset = gCurFile->cursor.y - gEditor.display_rows / 2;
   if (gCurFile->row_offset < 0)
   {
@@ -293,8 +318,59 @@ int getMousePosField(int x, int y)
   return FIELD_TEXT;
 }
 
+/**
+ * mousePosToWrapPos - Convert a text area position to a file position in wrap mode
+ * @x: Screen column, set to the rendered column
+ * @y: Screen row, set to the row index
+ */
+static void mousePosToWrapPos(int *x, int *y)
+{
+  int line = editorWrapTop(gCurFile) + *y - 1;
+  if (line < 0)
+  {
+    *x = 0;
+    *y = 0;
+    return;
+  }
+  if (line >= editorWrapTotal(gCurFile))
+  {
+    *y = gCurFile->num_rows - 1;
+    *x = editorRowCxToRx(&gCurFile->row[*y], gCurFile->row[*y].size);
+    return;
+  }
+
+  int sub, start, end;
+  int row = editorWrapRowAt(gCurFile, line, &sub);
+  editorWrapSpan(gCurFile, row, sub, &start, &end);
+
+  // Past the end of a screen line is its last character, unless it ends the row
+  int rsize = editorRowCxToRx(&gCurFile->row[row], gCurFile->row[row].size);
+  int col   = start + *x - gEditor.explorer.width - LILEX_WIDTH();
+  if (end < rsize && col >= end)
+  {
+    col = end - 1;
+  }
+  if (col > end)
+  {
+    col = end;
+  }
+  if (col < start)
+  {
+    col = start;
+  }
+
+  *x = col;
+  *y = row;
+}
+
 void mousePosToEditorPos(int *x, int *y)
 {
+  if (editorWrapReady(gCurFile))
+  {
+    mousePosToWrapPos(x, y);
+    return;
+  }
+
   int row = gCurFile->row_offset + *y - 1;
   if (row < 0)
   {
@@ -305,18 +381,19 @@ void mousePosToEditorPos(int *x, int *y)
   if (row >= gCurFile->num_rows)
   {
     *y = gCurFile->num_rows - 1;
-    *x = gCurFile->row[*y].rsize;
+    *x = editorRowCxToRx(&gCurFile->row[*y], gCurFile->row[*y].size);
     return;
   }
 
-  int col = *x - gEditor.explorer.width - LILEX_WIDTH() + gCurFile->col_offset;
+  int col   = *x - gEditor.explorer.width - LILEX_WIDTH() + gCurFile->col_offset;
+  int rsize = editorRowCxToRx(&gCurFile->row[row], gCurFile->row[row].size);
   if (col < 0)
   {
     col = 0;
   }
-  else if (col > gCurFile->row[row].rsize)
+  else if (col > rsize)
   {
-    col = gCurFile->row[row].rsize;
+    col = rsize;
   }
 
   *x = col;
@@ -325,6 +402,12 @@ void mousePosToEditorPos(int *x, int *y)
 
 void editorScroll(int dist)
 {
+  if (editorWrapReady(gCurFile))
+  {
+    editorWrapSetTop(gCurFile, editorWrapTop(gCurFile) + dist);
+    return;
+  }
+
   int line = gCurFile->row_offset + dist;
   if (line < 0)
   {
@@ -669,6 +752,11 @@ void editorProcessKeypress(void)
       editorOpenFilePrompt();
       return;
       // --- AKHIR MODIFIKASI ---
+
+    // Go to file
+    case CTRL_KEY('t'):
+      editorFinder();
+      return;
   }
 
   if (gEditor.state == EXPLORER_MODE && editorExplorerProcessKeypress(input))
@@ -687,14 +775,19 @@ void editorProcessKeypress(void)
   bool should_scroll = true;
 
   bool should_record_action = false;
+  bool extended             = false;
 
-  EditorAction *action = calloc_s(1, sizeof(EditorAction));
-  action->type         = ACTION_EDIT;
-  EditAction *edit     = &action->edit;
+  // Built here, only a recorded action takes a node of the history
+  EditorAction action = {.type = ACTION_EDIT};
+  EditAction  *edit   = &action.edit;
 
   edit->old_cursor = gCurFile->cursor;
 
   int c = input.type;
+
+  // Only typing extends the last action, any other key ends it
+  if (c != CHAR_INPUT && c != BACKSPACE && c != CTRL_KEY('h') && c != DEL_KEY)
+    editorSealAction(gCurFile);
   int x = input.data.cursor.x;
   int y = input.data.cursor.y;
 
@@ -730,7 +823,6 @@ void editorProcessKeypress(void)
     case CTRL_KEY('x'):
     {
       close_protect = -1;
-      editorFreeAction(action);
       bool dirty = false;
       for (int i = 0; i < gEditor.file_count; i++)
       {
@@ -757,7 +849,6 @@ void editorProcessKeypress(void)
     // Close current file
     case CTRL_KEY('w'):
       quit_protect = true;
-      editorFreeAction(action);
       editorCloseFile(gEditor.file_index);
       return;
 
@@ -775,7 +866,6 @@ void editorProcessKeypress(void)
         editorMsg("Tidak ada perubahan yang perlu disimpan. Tekan Enter untuk melanjutkan.");
       }
       waiting_for_enter_after_save = true;
-      editorFreeAction(action);
       return;
     // --- AKHIR MODIFIKASI ---
 
@@ -986,7 +1076,16 @@ void editorProcessKeypress(void)
       }
       edit->deleted_range.start_x = gCurFile->cursor.x;
       edit->deleted_range.start_y = gCurFile->cursor.y;
-      editorCopyText(&edit->deleted_text, edit->deleted_range);
+      if (editorExtendDelete(edit->deleted_range))
+      {
+        extended             = true;
+        should_record_action = false;
+      }
+      else
+      {
+        editorCopyText(&edit->deleted_text, edit->deleted_range);
+        edit->open = (edit->deleted_range.start_y == edit->deleted_range.end_y);
+      }
       editorDeleteText(edit->deleted_range);
     }
     break;
@@ -1094,7 +1193,17 @@ void editorProcessKeypress(void)
 
       edit->added_range.end_x = gCurFile->cursor.x;
       edit->added_range.end_y = gCurFile->cursor.y;
-      editorCopyText(&edit->added_text, edit->added_range);
+
+      // The pasted text is the added text, the record takes it over
+      if (c == PASTE_INPUT)
+      {
+        edit->added_text = input.data.paste;
+        input.data.paste = (EditorClipboard){0};
+      }
+      else
+      {
+        editorCopyText(&edit->added_text, edit->added_range);
+      }
     }
     break;
 
@@ -1157,6 +1266,25 @@ void editorProcessKeypress(void)
       gCurFile->cursor.is_selected   = (c == SHIFT_PAGE_UP || c == SHIFT_PAGE_DOWN);
       gCurFile->bracket_autocomplete = 0;
 
+      // Wrap mode moves the view and the cursor by a screen of lines
+      if (editorWrapReady(gCurFile))
+      {
+        int dist  = (c == PAGE_UP || c == SHIFT_PAGE_UP) ? -gEditor.display_rows
+                                                         : gEditor.display_rows;
+        int rx    = editorRowCxToRx(&gCurFile->row[gCurFile->cursor.y], gCurFile->cursor.x);
+        int start, end;
+        int sub  = editorWrapFindRx(gCurFile, gCurFile->cursor.y, rx, &start, &end);
+        int line = editorWrapLineOf(gCurFile, gCurFile->cursor.y) + sub + dist;
+        editorScroll(dist);
+
+        int x = rx - start + gEditor.explorer.width + LILEX_WIDTH();
+        int y = line - editorWrapTop(gCurFile) + 1;
+        mousePosToWrapPos(&x, &y);
+        gCurFile->cursor.y = y;
+        gCurFile->cursor.x = editorRowRxToCx(&gCurFile->row[y], x);
+        break;
+      }
+
       if (c == PAGE_UP || c == SHIFT_PAGE_UP)
       {
         gCurFile->cursor.y = gCurFile->row_offset;
@@ -1491,6 +1619,11 @@ void editorProcessKeypress(void)
           should_scroll = false;
           mouse_click   = 0;
           int row       = gCurFile->row_offset + y - 1;
+          if (editorWrapReady(gCurFile))
+          {
+            int sub;
+            row = editorWrapRowAt(gCurFile, editorWrapTop(gCurFile) + y - 1, &sub);
+          }
           if (row < 0)
             row = 0;
           if (row >= gCurFile->num_rows)
@@ -1611,7 +1744,6 @@ void editorProcessKeypress(void)
     // Close tab
     case SCROLL_PRESSED:
       // Return to prevent resetting close_protect
-      editorFreeAction(action);
       return;
 
     case SCROLL_RELEASED:
@@ -1619,7 +1751,6 @@ void editorProcessKeypress(void)
       if (getMousePosField(x, y) == FIELD_TOP_STATUS)
       {
         quit_protect = true;
-        editorFreeAction(action);
         editorCloseFile(handleTabClick(x));
         return;
       }
@@ -1646,7 +1777,7 @@ void editorProcessKeypress(void)
 
       int close_bracket = isOpenBracket(c);
       int open_bracket  = isCloseBracket(c);
-      if (!CONVAR_GETINT(bracket))
+      if (!CONVAR_GETINT(bracket) || (gCurFile->largefile & LARGEFILE_BRACKET))
       {
         editorInsertUnicode(c);
       }
@@ -1701,12 +1832,22 @@ void editorProcessKeypress(void)
 
       edit->added_range.end_x = gCurFile->cursor.x + x_offset;
       edit->added_range.end_y = gCurFile->cursor.y;
-      editorCopyText(&edit->added_text, edit->added_range);
+
+      // Plain typing goes into the action of the previous keys
+      if (x_offset == 0 && !edit->deleted_text.size && editorExtendInsert(edit->added_range))
+      {
+        extended = true;
+      }
+      else
+      {
+        editorCopyText(&edit->added_text, edit->added_range);
+        edit->open = (x_offset == 0);
+      }
 
       gCurFile->sx = editorRowCxToRx(&gCurFile->row[gCurFile->cursor.y], gCurFile->cursor.x);
       gCurFile->cursor.is_selected = false;
 
-      if (x_offset == -1)
+      if (x_offset == -1 || extended)
       {
         should_record_action = false;
       }
@@ -1735,14 +1876,18 @@ void editorProcessKeypress(void)
 
   editorFreeInput(&input);
 
-  if (should_record_action)
+  if (extended)
+  {
+    gCurFile->action_current->action->edit.new_cursor = gCurFile->cursor;
+  }
+  else if (should_record_action)
   {
     edit->new_cursor = gCurFile->cursor;
-    editorAppendAction(action);
+    editorAppendAction(&action);
   }
   else
   {
-    editorFreeAction(action);
+    editorFreeAction(&action);
   }
 
   if (should_scroll)
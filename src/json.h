@@ -80,7 +80,12 @@ JsonValue *json_parse(const char *text, JsonArena *arena);
 
 JsonValue *json_object_find(const JsonObject *object, const char *key);
 
-#ifdef JSON_IMPLEMENTATION
+#endif  // !JSON_H
+
+// The implementation has its own guard so the header can be included
+// before the file that defines JSON_IMPLEMENTATION includes it again.
+#if defined(JSON_IMPLEMENTATION) && !defined(JSON_IMPLEMENTATION_INCLUDED)
+#define JSON_IMPLEMENTATION_INCLUDED
 
 #include <stdarg.h>
 #include <stdio.h>
@@ -731,5 +736,3 @@ JsonValue *json_object_find(const JsonObject *object, const char *key)
 }
 
 #endif  // JSON_IMPLEMENTATION
-
-#endif  // !JSON_H
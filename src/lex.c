@@ -76,7 +76,7 @@ int main(int argc, char *argv[])
 
   while (gEditor.file_count || gEditor.explorer.node)
   {
-    editorRefreshScreen();
+    editorUpdateScreen();
     editorProcessKeypress();
   }
 
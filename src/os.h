@@ -24,6 +24,10 @@ void enableRawMode(void);
 void disableRawMode(void);
 
 bool readConsole(uint32_t *unicode_out, int timeout_ms);
+// Raw UTF-8 input in bulk, stops after an ESC, returns 0 on timeout. In the
+// middle of a sequence wait longer than ttimeoutlen, the link may stall.
+size_t readConsoleText(char *buf, size_t size, int timeout_ms);
+bool pollConsole(int timeout_ms);
 int  writeConsole(const void *buf, size_t count);
 int  getWindowSize(int *rows, int *cols);
 
@@ -31,6 +35,8 @@ int  getWindowSize(int *rows, int *cols);
 typedef struct FileInfo FileInfo;
 FileInfo                getFileInfo(const char *path);
 bool                    areFilesEqual(FileInfo f1, FileInfo f2);
+int64_t                 getFileModTime(FileInfo info);
+int64_t                 getFileSize(FileInfo info);
 
 typedef enum FileType
 {
@@ -46,6 +52,8 @@ DirIter                dirFindFirst(const char *path);
 bool                   dirNext(DirIter *iter);
 void                   dirClose(DirIter *iter);
 const char            *dirGetName(const DirIter *iter);
+bool                   dirIsDir(const DirIter *iter);
+bool                   dirIsLink(const DirIter *iter);
 
 FILE *openFile(const char *path, const char *mode);
 bool  changeDir(const char *path);
@@ -54,6 +62,27 @@ char *getFullPath(const char *path);
 // Time
 int64_t getTime(void);
 
+// Threads
+typedef struct Mutex Mutex;
+typedef struct Cond  Cond;
+bool                 threadStart(void (*func)(void *arg), void *arg);
+void                 mutexInit(Mutex *mutex);
+void                 mutexLock(Mutex *mutex);
+void                 mutexUnlock(Mutex *mutex);
+void                 condInit(Cond *cond);
+void                 condWait(Cond *cond, Mutex *mutex);
+void                 condSignal(Cond *cond);
+
+// Wake up a console read from another thread, it merges the work of the
+// background threads before it goes on waiting
+void wakeConsole(void);
+
+// File system watches, a console read passes their events to
+// editorWatchEvents before it goes on waiting. Returns 0 when the path
+// can't be watched.
+int  watchAdd(const char *path, bool is_dir);
+void watchRemove(int watch);
+
 // Command line
 void argsInit(int *argc, char ***argv);
 void argsFree(int argc, char **argv);
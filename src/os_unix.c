@@ -1,9 +1,13 @@
 #include "os_unix.h"
 
 #include "os.h"
+#include "file_io.h"
+#include "finder.h"
 #include "terminal.h"
+#include "unicode.h"
 #include "utils.h"
 
+#include <errno.h>
 #include <fcntl.h>
 #include <poll.h>
 #include <signal.h>
@@ -12,6 +16,8 @@
 #include <termios.h>
 
 static int                   sig_rd = -1, sig_wr = -1;
+static int                   wake_rd = -1, wake_wr = -1;
+static int                   watch_fd = -1;
 static volatile sig_atomic_t winch_queued = 0;
 
 static void SIGWINCH_handler(int sig)
@@ -36,6 +42,21 @@ void osInit(void)
   sig_rd = p[0];
   sig_wr = p[1];
 
+  // Wakes never block the thread that sends them
+  if (pipe(p) == -1)
+  {
+    PANIC("Failed to create pipe for waking up the console");
+  }
+  wake_rd = p[0];
+  wake_wr = p[1];
+  fcntl(wake_rd, F_SETFL, O_NONBLOCK);
+  fcntl(wake_wr, F_SETFL, O_NONBLOCK);
+
+#ifdef __linux__
+  // Live reload is off when there are no watches
+  watch_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+#endif
+
   struct sigaction winch_action = {
       .sa_handler = SIGWINCH_handler,
   };
@@ -71,21 +92,90 @@ void disableRawMode(void)
   UNUSED(tcsetattr(STDIN_FILENO, TCSAFLUSH, &orig_termios));
 }
 
-static bool readConsoleByte(uint8_t *out, int timeout_ms)
+/**
+ * readWatchEvents - Pass the pending watch events to the editor
+ *
+ * A burst of events, like from a checkout, usually hits the same few
+ * watches many times. Each watch is passed once per read.
+ */
+static void readWatchEvents(void)
+{
+#ifdef __linux__
+  _Alignas(struct inotify_event) char buf[4096];
+  int     watches[64];
+  int     count = 0;
+  ssize_t len;
+  while ((len = read(watch_fd, buf, sizeof(buf))) > 0)
+  {
+    for (char *p = buf; p < buf + len;)
+    {
+      const struct inotify_event *event = (const struct inotify_event *) p;
+      p += sizeof(struct inotify_event) + event->len;
+
+      int i = 0;
+      while (i < count && watches[i] != event->wd)
+      {
+        i++;
+      }
+      if (i < count)
+        continue;
+
+      if (count == (int) (sizeof(watches) / sizeof(watches[0])))
+      {
+        editorWatchEvents(watches, count);
+        count = 0;
+      }
+      watches[count++] = event->wd;
+    }
+  }
+
+  if (count)
+    editorWatchEvents(watches, count);
+#endif
+}
+
+// Console input read ahead, the bytes from in_pos to in_len are unread
+static uint8_t in_buf[65536];
+static size_t  in_pos = 0;
+static size_t  in_len = 0;
+
+/**
+ * fillConsole - Read the available console input into the buffer
+ * @timeout_ms: Time to wait for input, READ_WAIT_INFINITE to wait forever
+ *
+ * Handles the resizes, wakes and watch events that arrive meanwhile, also
+ * when input is ready so a long paste doesn't hold them back. The events
+ * don't extend the wait, a lone escape still times out. Callers in the
+ * middle of a sequence, like the text of a paste, must wait longer than
+ * ttimeoutlen.
+ *
+ * Returns: Whether input was read
+ */
+static bool fillConsole(int timeout_ms)
 {
-  struct pollfd fds[2] = {
+  struct pollfd fds[4] = {
       {.fd = STDIN_FILENO, .events = POLLIN},
       {.fd = sig_rd, .events = POLLIN},
+      {.fd = wake_rd, .events = POLLIN},
+      {.fd = watch_fd, .events = POLLIN},
   };
 
+  int64_t deadline = getTime() + (int64_t) timeout_ms * 1000;
+  int     wait     = timeout_ms;
   while (true)
   {
-    int ret = poll(fds, 2, timeout_ms);
-    if (ret < 0)
-      return false;
+    int ret = poll(fds, 4, wait);
+    if (timeout_ms > 0)
+    {
+      int64_t left = (deadline - getTime() + 999) / 1000;
+      wait         = (left < 0) ? 0 : (left > timeout_ms) ? timeout_ms : (int) left;
+    }
 
-    if (fds[0].revents & POLLIN)
-      return read(STDIN_FILENO, out, 1) == 1;
+    // A signal such as a resize isn't a timeout, wait for the rest of the time
+    if (ret < 0 && errno == EINTR)
+      continue;
+    if (ret <= 0)
+      return false;
 
     if (fds[1].revents & POLLIN)
     {
@@ -94,60 +184,123 @@ static bool readConsoleByte(uint8_t *out, int timeout_ms)
       resizeWindow();
       winch_queued = 0;
     }
+
+    if (fds[2].revents & POLLIN)
+    {
+      uint8_t buf[64];
+      while (read(wake_rd, buf, sizeof(buf)) > 0)
+      {
+      }
+      editorExplorerPoll();
+      editorFinderPoll();
+    }
+
+    if (fds[3].revents & POLLIN)
+      readWatchEvents();
+
+    if (fds[0].revents & POLLIN)
+    {
+      ssize_t len = read(STDIN_FILENO, in_buf, sizeof(in_buf));
+      if (len <= 0)
+        return false;
+      in_pos = 0;
+      in_len = len;
+      return true;
+    }
   }
 }
 
+static inline bool readConsoleByte(uint8_t *out, int timeout_ms)
+{
+  if (in_pos == in_len && !fillConsole(timeout_ms))
+    return false;
+  *out = in_buf[in_pos++];
+  return true;
+}
+
+bool pollConsole(int timeout_ms)
+{
+  if (in_pos < in_len)
+    return true;
+
+  struct pollfd fd = {.fd = STDIN_FILENO, .events = POLLIN};
+  return poll(&fd, 1, timeout_ms) > 0 && (fd.revents & POLLIN);
+}
+
 bool readConsole(uint32_t *unicode_out, int timeout_ms)
 {
-  uint8_t first_byte;
-  if (!readConsoleByte(&first_byte, timeout_ms))
+  uint8_t byte;
+  if (!readConsoleByte(&byte, timeout_ms))
   {
     return false;
   }
 
-  // ASCII fast-path
-  if ((first_byte & 0x80) == 0x00)
+  if (byte < 0x80)
   {
-    *unicode_out = (uint32_t) first_byte;
+    *unicode_out = byte;
     return true;
   }
 
-  // Decode UTF-8
-  int bytes;
-  if ((first_byte & 0xE0) == 0xC0)
-  {
-    *unicode_out = (first_byte & 0x1F) << 6;
-    bytes        = 1;
-  }
-  else if ((first_byte & 0xF0) == 0xE0)
+  // Same decoder as the text, invalid sequences are dropped
+  uint32_t state = UTF8_ACCEPT;
+  while (decodeUTF8Byte(&state, unicode_out, byte) != UTF8_ACCEPT)
   {
-    *unicode_out = (first_byte & 0x0F) << 12;
-    bytes        = 2;
-  }
-  else if ((first_byte & 0xF8) == 0xF0)
-  {
-    *unicode_out = (first_byte & 0x07) << 18;
-    bytes        = 3;
-  }
-  else
-  {
-    return false;
+    if (state == UTF8_REJECT || !readConsoleByte(&byte, READ_GRACE_MS))
+      return false;
   }
+  return true;
+}
 
-  int shift = (bytes - 1) * 6;
-  for (int i = 0; i < bytes; i++)
-  {
-    uint8_t byte;
-    if (!readConsoleByte(&byte, READ_GRACE_MS))
-      return false;
-    if ((byte & 0xC0) != 0x80)
-      return false;
+size_t readConsoleText(char *buf, size_t size, int timeout_ms)
+{
+  if (in_pos == in_len && !fillConsole(timeout_ms))
+    return 0;
 
-    *unicode_out |= (byte & 0x3F) << shift;
-    shift -= 6;
-  }
+  size_t len = in_len - in_pos;
+  if (len > size)
+    len = size;
 
-  return true;
+  // The caller looks at each escape, it may end the text
+  const uint8_t *esc = memchr(&in_buf[in_pos], ESC, len);
+  if (esc)
+    len = esc - &in_buf[in_pos] + 1;
+
+  memcpy(buf, &in_buf[in_pos], len);
+  in_pos += len;
+  return len;
+}
+
+void wakeConsole(void)
+{
+  const uint8_t b = 0x01;
+  UNUSED(write(wake_wr, &b, 1));
+}
+
+int watchAdd(const char *path, bool is_dir)
+{
+#ifdef __linux__
+  if (watch_fd == -1)
+    return 0;
+
+  uint32_t mask = is_dir ? (IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_ONLYDIR)
+                         : (IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB | IN_MOVE_SELF | IN_DELETE_SELF);
+  int watch = inotify_add_watch(watch_fd, path, mask);
+  return (watch < 0) ? 0 : watch;
+#else
+  UNUSED(path);
+  UNUSED(is_dir);
+  return 0;
+#endif
+}
+
+void watchRemove(int watch)
+{
+#ifdef __linux__
+  if (watch > 0)
+    inotify_rm_watch(watch_fd, watch);
+#else
+  UNUSED(watch);
+#endif
 }
 
 int writeConsole(const void *buf, size_t count)
@@ -179,6 +332,21 @@ bool areFilesEqual(FileInfo f1, FileInfo f2)
   return (f1.info.st_ino == f2.info.st_ino && f1.info.st_dev == f2.info.st_dev);
 }
 
+int64_t getFileModTime(FileInfo info)
+{
+#ifdef __APPLE__
+  struct timespec ts = info.info.st_mtimespec;
+#else
+  struct timespec ts = info.info.st_mtim;
+#endif
+  return (int64_t) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+int64_t getFileSize(FileInfo info)
+{
+  return (int64_t) info.info.st_size;
+}
+
 FileType getFileType(const char *path)
 {
   struct stat info;
@@ -231,6 +399,35 @@ const char *dirGetName(const DirIter *iter)
   return iter->entry->d_name;
 }
 
+bool dirIsDir(const DirIter *iter)
+{
+  if (iter->error || !iter->entry)
+    return false;
+
+  // Links and file systems without d_type need a stat
+  if (iter->entry->d_type != DT_UNKNOWN && iter->entry->d_type != DT_LNK)
+    return iter->entry->d_type == DT_DIR;
+
+  struct stat info;
+  if (fstatat(dirfd(iter->dp), iter->entry->d_name, &info, 0) == -1)
+    return false;
+  return S_ISDIR(info.st_mode);
+}
+
+bool dirIsLink(const DirIter *iter)
+{
+  if (iter->error || !iter->entry)
+    return false;
+
+  if (iter->entry->d_type != DT_UNKNOWN)
+    return iter->entry->d_type == DT_LNK;
+
+  struct stat info;
+  if (fstatat(dirfd(iter->dp), iter->entry->d_name, &info, AT_SYMLINK_NOFOLLOW) == -1)
+    return false;
+  return S_ISLNK(info.st_mode);
+}
+
 FILE *openFile(const char *path, const char *mode)
 {
   return fopen(path, mode);
@@ -278,6 +475,66 @@ int64_t getTime(void)
   return time_val.tv_sec * 1000000 + time_val.tv_usec;
 }
 
+typedef struct ThreadStart
+{
+  void (*func)(void *arg);
+  void *arg;
+} ThreadStart;
+
+static void *threadMain(void *data)
+{
+  ThreadStart start = *(ThreadStart *) data;
+  free(data);
+  start.func(start.arg);
+  return NULL;
+}
+
+bool threadStart(void (*func)(void *arg), void *arg)
+{
+  ThreadStart *start = malloc_s(sizeof(ThreadStart));
+  start->func        = func;
+  start->arg         = arg;
+
+  pthread_t thread;
+  if (pthread_create(&thread, NULL, threadMain, start) != 0)
+  {
+    free(start);
+    return false;
+  }
+  pthread_detach(thread);
+  return true;
+}
+
+void mutexInit(Mutex *mutex)
+{
+  pthread_mutex_init(&mutex->handle, NULL);
+}
+
+void mutexLock(Mutex *mutex)
+{
+  pthread_mutex_lock(&mutex->handle);
+}
+
+void mutexUnlock(Mutex *mutex)
+{
+  pthread_mutex_unlock(&mutex->handle);
+}
+
+void condInit(Cond *cond)
+{
+  pthread_cond_init(&cond->handle, NULL);
+}
+
+void condWait(Cond *cond, Mutex *mutex)
+{
+  pthread_cond_wait(&cond->handle, &mutex->handle);
+}
+
+void condSignal(Cond *cond)
+{
+  pthread_cond_signal(&cond->handle);
+}
+
 void argsInit(int *argc, char ***argv)
 {
   UNUSED(argc);
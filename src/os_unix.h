@@ -2,9 +2,14 @@
 #define OS_UNIX_H
 
 #include <dirent.h>
+#include <pthread.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
+#ifdef __linux__
+#include <sys/inotify.h>
+#endif
+
 #define ENV_HOME "HOME"
 #define CONF_DIR ".config/" EDITOR_NAME
 #define DIR_SEP "/"
@@ -33,4 +38,14 @@ struct DirIter
   bool error;
 };
 
+struct Mutex
+{
+  pthread_mutex_t handle;
+};
+
+struct Cond
+{
+  pthread_cond_t handle;
+};
+
 #endif
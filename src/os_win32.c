@@ -1,12 +1,16 @@
 #include "os_win32.h"
 
 #include "os.h"
+#include "file_io.h"
+#include "finder.h"
 #include "terminal.h"
+#include "unicode.h"
 
 #include <shellapi.h>
 
 static HANDLE hStdin  = INVALID_HANDLE_VALUE;
 static HANDLE hStdout = INVALID_HANDLE_VALUE;
+static HANDLE hWake   = NULL;
 
 static UINT  orig_cp_in;
 static UINT  orig_cp_out;
@@ -21,6 +25,9 @@ void osInit(void)
   hStdout = GetStdHandle(STD_OUTPUT_HANDLE);
   if (hStdout == INVALID_HANDLE_VALUE)
     PANIC("Failed to get handle for standard output");
+  hWake = CreateEvent(NULL, FALSE, FALSE, NULL);
+  if (hWake == NULL)
+    PANIC("Failed to create event for waking up the console");
 }
 
 void enableRawMode(void)
@@ -63,11 +70,23 @@ void disableRawMode(void)
   SetConsoleOutputCP(orig_cp_out);
 }
 
-static bool readConsoleWChar(WCHAR *out, int timeout_ms)
+// Characters left of a key event with a repeat count
+static DWORD repeat_left = 0;
+static WCHAR repeat_char = 0;
+
+// Console input read ahead, the records from rec_pos to rec_len are unread
+static INPUT_RECORD recs[256];
+static DWORD        rec_pos = 0;
+static DWORD        rec_len = 0;
+
+static inline bool isCharEvent(const INPUT_RECORD *rec)
 {
-  static DWORD repeat_left = 0;
-  static WCHAR repeat_char = 0;
+  return rec->EventType == KEY_EVENT && rec->Event.KeyEvent.bKeyDown &&
+         rec->Event.KeyEvent.uChar.UnicodeChar;
+}
 
+static bool readConsoleWChar(WCHAR *out, int timeout_ms)
+{
   if (repeat_left)
   {
     *out = repeat_char;
@@ -75,62 +94,69 @@ static bool readConsoleWChar(WCHAR *out, int timeout_ms)
     return true;
   }
 
-  DWORD wait = (timeout_ms < 0) ? INFINITE : (DWORD) timeout_ms;
-
-  if (wait != 0)
+  if (rec_pos == rec_len)
   {
-    DWORD wr = WaitForSingleObject(hStdin, wait);
-    if (wr == WAIT_TIMEOUT)
+    DWORD wait = (timeout_ms < 0) ? INFINITE : (DWORD) timeout_ms;
+
+    if (wait != 0)
+    {
+      // Wakes don't extend the wait, a lone escape still times out
+      HANDLE    handles[2] = {hStdin, hWake};
+      ULONGLONG deadline   = GetTickCount64() + wait;
+      DWORD     wr;
+      while ((wr = WaitForMultipleObjects(2, handles, FALSE, wait)) == WAIT_OBJECT_0 + 1)
+      {
+        editorExplorerPoll();
+        editorFinderPoll();
+        if (wait != INFINITE)
+        {
+          ULONGLONG now = GetTickCount64();
+          wait          = (now >= deadline) ? 0 : (DWORD) (deadline - now);
+        }
+      }
+      if (wr == WAIT_TIMEOUT)
+        return false;
+      if (wr != WAIT_OBJECT_0)
+        return false;
+    }
+
+    DWORD avail = 0;
+    if (!GetNumberOfConsoleInputEvents(hStdin, &avail) || avail == 0)
       return false;
-    if (wr != WAIT_OBJECT_0)
+
+    // All the available records in one call, a paste is many of them
+    rec_pos = 0;
+    if (!ReadConsoleInputW(hStdin, recs, sizeof(recs) / sizeof(recs[0]), &rec_len))
+    {
+      rec_len = 0;
       return false;
+    }
   }
 
-  DWORD avail = 0;
-  if (!GetNumberOfConsoleInputEvents(hStdin, &avail) || avail == 0)
-    return false;
-
   COORD last_size  = (COORD){0, 0};
   bool  saw_resize = false;
 
-  INPUT_RECORD rec;
-  DWORD        read = 0;
-
-  while (avail--)
+  while (rec_pos < rec_len)
   {
-    if (!ReadConsoleInputW(hStdin, &rec, 1, &read) || read == 0)
-      break;
-
-    switch (rec.EventType)
+    const INPUT_RECORD *rec = &recs[rec_pos++];
+    if (rec->EventType == WINDOW_BUFFER_SIZE_EVENT)
     {
-      case WINDOW_BUFFER_SIZE_EVENT:
-      {
-        last_size  = rec.Event.WindowBufferSizeEvent.dwSize;
-        saw_resize = true;
-      }
-      break;
-
-      case KEY_EVENT:
+      last_size  = rec->Event.WindowBufferSizeEvent.dwSize;
+      saw_resize = true;
+    }
+    else if (isCharEvent(rec))
+    {
+      const KEY_EVENT_RECORD *ev = &rec->Event.KeyEvent;
+      const WCHAR             ch = ev->uChar.UnicodeChar;
+      if (ev->wRepeatCount > 1)
       {
-        const KEY_EVENT_RECORD *ev = &rec.Event.KeyEvent;
-        if (ev->bKeyDown && ev->uChar.UnicodeChar)
-        {
-          const WCHAR ch = ev->uChar.UnicodeChar;
-          if (ev->wRepeatCount > 1)
-          {
-            repeat_left = ev->wRepeatCount - 1;
-            repeat_char = ch;
-          }
-          *out = ch;
-          if (saw_resize)
-            setWindowSize(last_size.Y, last_size.X);
-          return true;
-        }
+        repeat_left = ev->wRepeatCount - 1;
+        repeat_char = ch;
       }
-      break;
-
-      default:
-        break;
+      *out = ch;
+      if (saw_resize)
+        setWindowSize(last_size.Y, last_size.X);
+      return true;
     }
   }
 
@@ -159,6 +185,35 @@ static inline bool isLowSurrogate(WCHAR u)
   return u >= 0xDC00 && u <= 0xDFFF;
 }
 
+bool pollConsole(int timeout_ms)
+{
+  if (repeat_left)
+    return true;
+
+  for (DWORD i = rec_pos; i < rec_len; i++)
+  {
+    if (isCharEvent(&recs[i]))
+      return true;
+  }
+
+  DWORD wait = (timeout_ms < 0) ? INFINITE : (DWORD) timeout_ms;
+  if (WaitForSingleObject(hStdin, wait) != WAIT_OBJECT_0)
+    return false;
+
+  // Only key events produce input, others are consumed by the next read
+  INPUT_RECORD peek[64];
+  DWORD        count = 0;
+  if (!PeekConsoleInputW(hStdin, peek, 64, &count))
+    return false;
+
+  for (DWORD i = 0; i < count; i++)
+  {
+    if (isCharEvent(&peek[i]))
+      return true;
+  }
+  return false;
+}
+
 bool readConsole(uint32_t *unicode_out, int timeout_ms)
 {
   WCHAR b0;
@@ -188,6 +243,23 @@ bool readConsole(uint32_t *unicode_out, int timeout_ms)
   return true;
 }
 
+size_t readConsoleText(char *buf, size_t size, int timeout_ms)
+{
+  size_t   len = 0;
+  uint32_t c;
+
+  // Only wait for the first character, then take what is already there
+  while (len + 4 <= size && readConsole(&c, len ? 0 : timeout_ms))
+  {
+    int bytes = encodeUTF8(c, &buf[len]);
+    if (bytes > 0)
+      len += bytes;
+    if (c == ESC)
+      break;
+  }
+  return len;
+}
+
 int getWindowSize(int *rows, int *cols)
 {
   CONSOLE_SCREEN_BUFFER_INFO csbi;
@@ -207,8 +279,9 @@ FileInfo getFileInfo(const char *path)
   wchar_t  w_path[EDITOR_PATH_MAX + 1] = {0};
   MultiByteToWideChar(CP_UTF8, 0, path, -1, w_path, EDITOR_PATH_MAX);
 
+  // FILE_FLAG_BACKUP_SEMANTICS is required to open directories
   HANDLE hFile = CreateFileW(w_path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
-                             FILE_ATTRIBUTE_NORMAL, NULL);
+                             FILE_ATTRIBUTE_NORMAL | FILE_FLAG_BACKUP_SEMANTICS, NULL);
   if (hFile == INVALID_HANDLE_VALUE)
     goto errdefer;
 
@@ -233,6 +306,20 @@ bool areFilesEqual(FileInfo f1, FileInfo f2)
           f1.info.nFileIndexLow == f2.info.nFileIndexLow);
 }
 
+int64_t getFileModTime(FileInfo info)
+{
+  // FILETIME is in 100-nanosecond intervals
+  ULARGE_INTEGER time;
+  time.LowPart  = info.info.ftLastWriteTime.dwLowDateTime;
+  time.HighPart = info.info.ftLastWriteTime.dwHighDateTime;
+  return (int64_t) (time.QuadPart / 10);
+}
+
+int64_t getFileSize(FileInfo info)
+{
+  return ((int64_t) info.info.nFileSizeHigh << 32) | info.info.nFileSizeLow;
+}
+
 FileType getFileType(const char *path)
 {
   DWORD attri = GetFileAttributes(path);
@@ -255,6 +342,9 @@ DirIter dirFindFirst(const char *path)
 
   iter.handle = FindFirstFileW(entry_path, &iter.find_data);
   iter.error  = (iter.handle == INVALID_HANDLE_VALUE);
+  if (!iter.error)
+    WideCharToMultiByte(CP_UTF8, 0, iter.find_data.cFileName, -1, iter.name, sizeof(iter.name),
+                        NULL, false);
 
   return iter;
 }
@@ -263,7 +353,11 @@ bool dirNext(DirIter *iter)
 {
   if (iter->error)
     return false;
-  return FindNextFileW(iter->handle, &iter->find_data) != 0;
+  if (!FindNextFileW(iter->handle, &iter->find_data))
+    return false;
+  WideCharToMultiByte(CP_UTF8, 0, iter->find_data.cFileName, -1, iter->name, sizeof(iter->name),
+                      NULL, false);
+  return true;
 }
 
 void dirClose(DirIter *iter)
@@ -275,14 +369,23 @@ void dirClose(DirIter *iter)
 
 const char *dirGetName(const DirIter *iter)
 {
-  static char dir_name[EDITOR_PATH_MAX * 4];
-
   if (iter->error)
     return NULL;
+  return iter->name;
+}
+
+bool dirIsDir(const DirIter *iter)
+{
+  if (iter->error)
+    return false;
+  return (iter->find_data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+}
 
-  WideCharToMultiByte(CP_UTF8, 0, iter->find_data.cFileName, -1, dir_name, EDITOR_PATH_MAX, NULL,
-                      false);
-  return dir_name;
+bool dirIsLink(const DirIter *iter)
+{
+  if (iter->error)
+    return false;
+  return (iter->find_data.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) != 0;
 }
 
 FILE *openFile(const char *path, const char *mode)
@@ -343,6 +446,83 @@ int64_t getTime(void)
   return sec * 1000000 + usec;
 }
 
+typedef struct ThreadStart
+{
+  void (*func)(void *arg);
+  void *arg;
+} ThreadStart;
+
+static DWORD WINAPI threadMain(LPVOID data)
+{
+  ThreadStart start = *(ThreadStart *) data;
+  free(data);
+  start.func(start.arg);
+  return 0;
+}
+
+bool threadStart(void (*func)(void *arg), void *arg)
+{
+  ThreadStart *start = malloc_s(sizeof(ThreadStart));
+  start->func        = func;
+  start->arg         = arg;
+
+  HANDLE thread = CreateThread(NULL, 0, threadMain, start, 0, NULL);
+  if (thread == NULL)
+  {
+    free(start);
+    return false;
+  }
+  CloseHandle(thread);
+  return true;
+}
+
+void mutexInit(Mutex *mutex)
+{
+  InitializeSRWLock(&mutex->handle);
+}
+
+void mutexLock(Mutex *mutex)
+{
+  AcquireSRWLockExclusive(&mutex->handle);
+}
+
+void mutexUnlock(Mutex *mutex)
+{
+  ReleaseSRWLockExclusive(&mutex->handle);
+}
+
+void condInit(Cond *cond)
+{
+  InitializeConditionVariable(&cond->handle);
+}
+
+void condWait(Cond *cond, Mutex *mutex)
+{
+  SleepConditionVariableSRW(&cond->handle, &mutex->handle, INFINITE, 0);
+}
+
+void condSignal(Cond *cond)
+{
+  WakeConditionVariable(&cond->handle);
+}
+
+void wakeConsole(void)
+{
+  SetEvent(hWake);
+}
+
+int watchAdd(const char *path, bool is_dir)
+{
+  UNUSED(path);
+  UNUSED(is_dir);
+  return 0;
+}
+
+void watchRemove(int watch)
+{
+  UNUSED(watch);
+}
+
 void argsInit(int *argc, char ***argv)
 {
   LPWSTR *w_argv = CommandLineToArgvW(GetCommandLineW(), argc);
@@ -24,8 +24,19 @@ struct DirIter
 {
   HANDLE           handle;
   WIN32_FIND_DATAW find_data;
+  char             name[EDITOR_PATH_MAX * 4];  // UTF-8 copy of the name, per iterator for threads
 
   bool error;
 };
 
+struct Mutex
+{
+  SRWLOCK handle;
+};
+
+struct Cond
+{
+  CONDITION_VARIABLE handle;
+};
+
 #endif
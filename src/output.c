@@ -2,8 +2,10 @@
 
 #include "config.h"
 #include "editor.h"
+#include "finder.h"
 #include "highlight.h"
 #include "os.h"
+#include "screen.h"
 #include "select.h"
 #include "terminal.h"
 #include "unicode.h"
@@ -12,15 +14,14 @@
 
 /**
  * editorDrawTopStatusBar - Draw the top status bar with file tabs
- * @ab: Append buffer to write to
  * 
  * Draws the top bar showing:
  * - Navigation arrows (< >) if there are more tabs
- * - File tabs with names and dirty indicators (*)
+ * - File tabs with names, dirty (*) and changed on disk (!) indicators
  * - Editor name and version on the right
  * - Loading message when in loading state
  */
-static void editorDrawTopStatusBar(abuf *ab)
+static void editorDrawTopStatusBar(void)
 {
   const char *right_buf      = "  " EDITOR_NAME " v" EDITOR_VERSION " ";
   bool        has_more_files = false;
@@ -28,16 +29,16 @@ static void editorDrawTopStatusBar(abuf *ab)
   int         len            = gEditor.explorer.width;
 
   // Move to the position after explorer panel
-  gotoXY(ab, 1, gEditor.explorer.width + 1);
+  screenMoveTo(1, gEditor.explorer.width + 1);
 
   // Set colors for top status bar
-  setColor(ab, gEditor.color_cfg.top_status[0], 0);
-  setColor(ab, gEditor.color_cfg.top_status[1], 1);
+  screenSetColor(&gEditor.color_cfg.top_status[0], 0);
+  screenSetColor(&gEditor.color_cfg.top_status[1], 1);
 
   // Draw left arrow if there are tabs scrolled off-screen to the left
   if (gEditor.tab_offset != 0)
   {
-    abufAppendN(ab, "<", 1);
+    screenPutN("<", 1);
     len++;
   }
 
@@ -48,7 +49,7 @@ static void editorDrawTopStatusBar(abuf *ab)
   {
     const char *loading_text     = "Loading...";
     int         loading_text_len = strlen(loading_text);
-    abufAppendN(ab, loading_text, loading_text_len);
+    screenPutN(loading_text, loading_text_len);
     len = loading_text_len;
   }
   else
@@ -66,13 +67,13 @@ static void editorDrawTopStatusBar(abuf *ab)
       bool is_current = (file == gCurFile);
       if (is_current)
       {
-        setColor(ab, gEditor.color_cfg.top_status[4], 0);
-        setColor(ab, gEditor.color_cfg.top_status[5], 1);
+        screenSetColor(&gEditor.color_cfg.top_status[4], 0);
+        screenSetColor(&gEditor.color_cfg.top_status[5], 1);
       }
       else
       {
-        setColor(ab, gEditor.color_cfg.top_status[2], 0);
-        setColor(ab, gEditor.color_cfg.top_status[3], 1);
+        screenSetColor(&gEditor.color_cfg.top_status[2], 0);
+        screenSetColor(&gEditor.color_cfg.top_status[3], 1);
       }
 
       // Format tab text with filename and dirty indicator
@@ -80,8 +81,9 @@ static void editorDrawTopStatusBar(abuf *ab)
       char buf[EDITOR_PATH_MAX] = {0};
       if (file->filename)
       {
-        buf_len = snprintf(buf, sizeof(buf), " %s%s ", file->dirty ? "*" : "",
-                           getBaseName(file->filename));
+        // Files changed on disk are marked with !
+        buf_len = snprintf(buf, sizeof(buf), " %s%s%s ", file->disk_changed ? "!" : "",
+                           file->dirty ? "*" : "", getBaseName(file->filename));
       }
       else
       {
@@ -114,20 +116,20 @@ static void editorDrawTopStatusBar(abuf *ab)
       if (tab_width < 0)
         break;
 
-      abufAppendN(ab, buf, buf_len);
+      screenPutN(buf, buf_len);
       len += tab_width;
       gEditor.tab_displayed++;
     }
   }
 
   // Reset to default status bar colors
-  setColor(ab, gEditor.color_cfg.top_status[0], 0);
-  setColor(ab, gEditor.color_cfg.top_status[1], 1);
+  screenSetColor(&gEditor.color_cfg.top_status[0], 0);
+  screenSetColor(&gEditor.color_cfg.top_status[1], 1);
 
   // Draw right arrow if there are more tabs off-screen to the right
   if (has_more_files)
   {
-    abufAppendN(ab, ">", 1);
+    screenPutN(">", 1);
     len++;
   }
 
@@ -136,12 +138,12 @@ static void editorDrawTopStatusBar(abuf *ab)
   {
     if (gEditor.screen_cols - len == rlen)
     {
-      abufAppendN(ab, right_buf, rlen);
+      screenPutN(right_buf, rlen);
       break;
     }
     else
     {
-      abufAppendN(ab, " ", 1);
+      screenPutN(" ", 1);
       len++;
     }
   }
@@ -149,13 +151,12 @@ static void editorDrawTopStatusBar(abuf *ab)
 
 /**
  * editorDrawConMsg - Draw console messages
- * @ab: Append buffer to write to
  * 
  * Draws console/status messages at the bottom of the screen,
  * just above the prompt line. Messages are displayed in a
  * circular buffer queue.
  */
-static void editorDrawConMsg(abuf *ab)
+static void editorDrawConMsg(void)
 {
   // Return early if no messages to display
   if (gEditor.con_size == 0)
@@ -164,8 +165,8 @@ static void editorDrawConMsg(abuf *ab)
   }
 
   // Set prompt colors for console messages
-  setColor(ab, gEditor.color_cfg.prompt[0], 0);
-  setColor(ab, gEditor.color_cfg.prompt[1], 1);
+  screenSetColor(&gEditor.color_cfg.prompt[0], 0);
+  screenSetColor(&gEditor.color_cfg.prompt[1], 1);
 
   // Calculate starting row for console messages
   bool should_draw_prompt = (gEditor.state != EDIT_MODE && gEditor.state != EXPLORER_MODE);
@@ -179,7 +180,7 @@ static void editorDrawConMsg(abuf *ab)
   int index = gEditor.con_front;
   for (int i = 0; i < gEditor.con_size; i++)
   {
-    gotoXY(ab, draw_x, 0);
+    screenMoveTo(draw_x, 0);
     draw_x++;
 
     const char *buf = gEditor.con_msg[index];
@@ -192,26 +193,64 @@ static void editorDrawConMsg(abuf *ab)
       len = gEditor.screen_cols;
     }
 
-    abufAppendN(ab, buf, len);
+    screenPutN(buf, len);
 
     // Fill rest of line with spaces
     while (len < gEditor.screen_cols)
     {
-      abufAppendN(ab, " ", 1);
+      screenPutN(" ", 1);
       len++;
     }
   }
 }
 
+/**
+ * editorDrawFinder - Draw the matches of the go to file prompt
+ *
+ * The list takes the rows above the prompt line, the best match first.
+ * It scrolls to keep the selected match in view.
+ */
+static void editorDrawFinder(void)
+{
+  if (gEditor.state != FINDER_MODE)
+    return;
+
+  const EditorFinderView *view = editorFinderGetView();
+  int                     rows = view->count;
+  if (rows > EDITOR_FINDER_ROWS)
+    rows = EDITOR_FINDER_ROWS;
+  if (rows > gEditor.display_rows - 1)
+    rows = gEditor.display_rows - 1;
+
+  int first = (view->selected >= rows) ? view->selected - rows + 1 : 0;
+  for (int i = 0; i < rows; i++)
+  {
+    screenMoveTo(gEditor.screen_rows - 1 - rows + i, 0);
+    screenSetColor(&gEditor.color_cfg.prompt[0], 0);
+    screenSetColor(&gEditor.color_cfg.prompt[1], 1);
+    if (first + i == view->selected)
+      screenSetAttr(SCREEN_ATTR_INVERT);
+
+    // Pad to the full width so the selection spans the row
+    const char *path = view->paths[first + i];
+    screenPutStr(" ");
+    screenPutN(path, strlen(path));
+    for (int col = strUTF8Width(path) + 1; col < gEditor.screen_cols; col++)
+    {
+      screenPutStr(" ");
+    }
+    screenSetAttr(0);
+  }
+}
+
 /**
  * editorDrawPrompt - Draw the prompt line
- * @ab: Append buffer to write to
  * 
  * Draws the command prompt at the bottom of the screen when
  * not in edit or explorer mode. Shows prompt text on left
  * and additional info on right.
  */
-static void editorDrawPrompt(abuf *ab)
+static void editorDrawPrompt(void)
 {
   // Only draw prompt in non-edit modes
   bool should_draw_prompt = (gEditor.state != EDIT_MODE && gEditor.state != EXPLORER_MODE);
@@ -221,11 +260,11 @@ static void editorDrawPrompt(abuf *ab)
   }
 
   // Set prompt colors
-  setColor(ab, gEditor.color_cfg.prompt[0], 0);
-  setColor(ab, gEditor.color_cfg.prompt[1], 1);
+  screenSetColor(&gEditor.color_cfg.prompt[0], 0);
+  screenSetColor(&gEditor.color_cfg.prompt[1], 1);
 
   // Move to bottom line
-  gotoXY(ab, gEditor.screen_rows - 1, 0);
+  screenMoveTo(gEditor.screen_rows - 1, 0);
 
   // Get left and right prompt text
   const char *left = gEditor.prompt;
@@ -246,19 +285,19 @@ static void editorDrawPrompt(abuf *ab)
     len = gEditor.screen_cols - rlen;
   }
 
-  abufAppendN(ab, left, len);
+  screenPutN(left, len);
 
   // Fill middle with spaces and draw right text at end
   while (len < gEditor.screen_cols)
   {
     if (gEditor.screen_cols - len == rlen)
     {
-      abufAppendN(ab, right, rlen);
+      screenPutN(right, rlen);
       break;
     }
     else
     {
-      abufAppendN(ab, " ", 1);
+      screenPutN(" ", 1);
       len++;
     }
   }
@@ -266,21 +305,20 @@ static void editorDrawPrompt(abuf *ab)
 
 /**
  * editorDrawStatusBar - Draw the bottom status bar
- * @ab: Append buffer to write to
  * 
  * Draws the status bar at the very bottom showing:
  * - Help text with keyboard shortcuts (left)
  * - File type/language (middle-right)
  * - Cursor position and line info (right)
  */
-static void editorDrawStatusBar(abuf *ab)
+static void editorDrawStatusBar(void)
 {
   // Move to last row
-  gotoXY(ab, gEditor.screen_rows, 0);
+  screenMoveTo(gEditor.screen_rows, 0);
 
   // Set status bar colors
-  setColor(ab, gEditor.color_cfg.status[0], 0);
-  setColor(ab, gEditor.color_cfg.status[1], 1);
+  screenSetColor(&gEditor.color_cfg.status[0], 0);
+  screenSetColor(&gEditor.color_cfg.status[1], 1);
 
   const char *help_str = "";
   
@@ -297,6 +335,8 @@ static void editorDrawStatusBar(abuf *ab)
       " ^X: Cancel",
       " ^X: Cancel",
       " ^X: Cancel",
+      " ^X: Cancel",
+      " ^X: Cancel  Up/Down: Select",
   };
   // END MODIFICATION
   
@@ -304,7 +344,7 @@ static void editorDrawStatusBar(abuf *ab)
   if (CONVAR_GETINT(helpinfo))
     help_str = help_info[gEditor.state];
 
-  char lang[16];
+  char lang[40];
   char pos[64];
   int  len = strlen(help_str);
   int  lang_len, pos_len;
@@ -318,7 +358,7 @@ static void editorDrawStatusBar(abuf *ab)
   }
   else
   {
-    // Get file type/language
+    // Get file type/language, and whether large file mode is on
     const char *file_type = gCurFile->syntax ? gCurFile->syntax->file_type : "Plain Text";
     
     // Calculate cursor row and column (1-indexed for display)
@@ -328,13 +368,20 @@ static void editorDrawStatusBar(abuf *ab)
     // Calculate line percentage for scroll position
     float       line_percent = 0.0f;
     const char *nl_type      = (gCurFile->newline == NL_UNIX) ? "LF" : "CRLF";
-    if (gCurFile->num_rows - 1 > 0)
+    if (editorWrapReady(gCurFile))
+    {
+      int total = editorWrapTotal(gCurFile);
+      if (total - 1 > 0)
+        line_percent = (float) editorWrapTop(gCurFile) / (total - 1) * 100.0f;
+    }
+    else if (gCurFile->num_rows - 1 > 0)
     {
       line_percent = (float) gCurFile->row_offset / (gCurFile->num_rows - 1) * 100.0f;
     }
 
     // Format language and position strings
-    lang_len = snprintf(lang, sizeof(lang), "  %s  ", file_type);
+    lang_len = snprintf(lang, sizeof(lang), "  %s%s  ", file_type,
+                        gCurFile->largefile ? " [Large]" : "");
     pos_len  = snprintf(pos, sizeof(pos), " %d:%d [%.f%%] <%s> ", row, col, line_percent, nl_type);
   }
 
@@ -347,7 +394,7 @@ static void editorDrawStatusBar(abuf *ab)
     len = gEditor.screen_cols - rlen;
 
   // Draw help text
-  abufAppendN(ab, help_str, len);
+  screenPutN(help_str, len);
 
   // Fill middle and draw file info on right
   while (len < gEditor.screen_cols)
@@ -355,19 +402,19 @@ static void editorDrawStatusBar(abuf *ab)
     if (gEditor.screen_cols - len == rlen)
     {
       // Draw language/file type
-      setColor(ab, gEditor.color_cfg.status[2], 0);
-      setColor(ab, gEditor.color_cfg.status[3], 1);
-      abufAppendN(ab, lang, lang_len);
+      screenSetColor(&gEditor.color_cfg.status[2], 0);
+      screenSetColor(&gEditor.color_cfg.status[3], 1);
+      screenPutN(lang, lang_len);
       
       // Draw position info
-      setColor(ab, gEditor.color_cfg.status[4], 0);
-      setColor(ab, gEditor.color_cfg.status[5], 1);
-      abufAppendN(ab, pos, pos_len);
+      screenSetColor(&gEditor.color_cfg.status[4], 0);
+      screenSetColor(&gEditor.color_cfg.status[5], 1);
+      screenPutN(pos, pos_len);
       break;
     }
     else
     {
-      abufAppendN(ab, " ", 1);
+      screenPutN(" ", 1);
       len++;
     }
   }
@@ -375,7 +422,6 @@ static void editorDrawStatusBar(abuf *ab)
 
 /**
  * editorDrawRows - Draw the text editor content area
- * @ab: Append buffer to write to
  * 
  * Draws all visible text rows with:
  * - Line numbers (if enabled)
@@ -384,28 +430,46 @@ static void editorDrawStatusBar(abuf *ab)
  * - Special character visualization (tabs, spaces, control chars)
  * - Current line highlighting
  */
-static void editorDrawRows(abuf *ab)
+static void editorDrawRows(void)
 {
   // Set background color
-  setColor(ab, gEditor.color_cfg.bg, 1);
+  screenSetColor(&gEditor.color_cfg.bg, 1);
 
   // Get selection range if text is selected
   EditorSelectRange range = {0};
   if (gCurFile->cursor.is_selected)
     getSelectStartEnd(&range);
 
+  // Whitespace rendering is off in large file mode
+  bool drawspace = CONVAR_GETINT(drawspace) && !(gCurFile->largefile & LARGEFILE_DRAWSPACE);
+  bool trailing  = CONVAR_GETINT(trailing) && !(gCurFile->largefile & LARGEFILE_TRAILING);
+
+  // Background colors, the normal one changes on the current line
+  const Color *bg_colors[HL_BG_COUNT];
+  for (int i = 0; i < HL_BG_COUNT; i++)
+  {
+    bg_colors[i] = &gEditor.color_cfg.highlightBg[i];
+  }
+
+  // Wrap mode draws the screen lines of each row, from a screen line of the first row
+  bool wrap    = editorWrapReady(gCurFile);
+  int  i       = gCurFile->row_offset;
+  int  sub     = 0;
+  int  wrap_rx = -1;
+  if (wrap)
+    i = editorWrapRowAt(gCurFile, editorWrapTop(gCurFile), &sub);
+
   // Draw each visible row
-  for (int i = gCurFile->row_offset, s_row = 2; i < gCurFile->row_offset + gEditor.display_rows;
-       i++, s_row++)
+  for (int s_row = 2; s_row < gEditor.display_rows + 2; s_row++)
   {
     int  len;
     bool is_row_full = false;
 
     // Move cursor to the beginning of the row
-    gotoXY(ab, s_row, 1 + gEditor.explorer.width);
+    screenMoveTo(s_row, 1 + gEditor.explorer.width);
 
     // Set default background for normal text
-    gEditor.color_cfg.highlightBg[HL_BG_NORMAL] = gEditor.color_cfg.bg;
+    bg_colors[HL_BG_NORMAL] = &gEditor.color_cfg.bg;
     
     // Only draw if row exists in file
     if (i < gCurFile->num_rows)
@@ -421,65 +485,104 @@ static void editorDrawRows(abuf *ab)
           // Only highlight line if no selection active
           if (!gCurFile->cursor.is_selected)
           {
-            gEditor.color_cfg.highlightBg[HL_BG_NORMAL] = gEditor.color_cfg.cursor_line;
+            bg_colors[HL_BG_NORMAL] = &gEditor.color_cfg.cursor_line;
           }
-          setColor(ab, gEditor.color_cfg.line_number[1], 0);
-          setColor(ab, gEditor.color_cfg.line_number[0], 1);
+          screenSetColor(&gEditor.color_cfg.line_number[1], 0);
+          screenSetColor(&gEditor.color_cfg.line_number[0], 1);
         }
         else
         {
-          setColor(ab, gEditor.color_cfg.line_number[0], 0);
-          setColor(ab, gEditor.color_cfg.line_number[1], 1);
+          screenSetColor(&gEditor.color_cfg.line_number[0], 0);
+          screenSetColor(&gEditor.color_cfg.line_number[1], 1);
         }
 
-        // Format and draw line number (1-indexed)
-        len = snprintf(line_number, sizeof(line_number), " %*d ", gCurFile->lilex_width - 2,
-                       i + 1);
+        // Format and draw line number (1-indexed), blank on wrapped lines
+        if (sub == 0)
+          len = snprintf(line_number, sizeof(line_number), " %*d ", gCurFile->lilex_width - 2,
+                         i + 1);
+        else
+          len = snprintf(line_number, sizeof(line_number), "%*s", gCurFile->lilex_width, "");
 
-        abufAppendN(ab, line_number, len);
+        screenPutN(line_number, len);
       }
 
       // Clear to end of line and reset colors
-      abufAppendStr(ab, ANSI_CLEAR);
-      setColor(ab, gEditor.color_cfg.bg, 1);
+      screenResetColor();
+      screenSetColor(&gEditor.color_cfg.bg, 1);
 
       // Calculate visible columns and starting position
-      int cols       = gEditor.screen_cols - gEditor.explorer.width - LILEX_WIDTH();
-      int col_offset = editorRowRxToCx(&gCurFile->row[i], gCurFile->col_offset);
+      int cols     = gEditor.screen_cols - gEditor.explorer.width - LILEX_WIDTH();
+      int rsize    = editorRowCxToRx(&gCurFile->row[i], gCurFile->row[i].size);
+      int start_rx = gCurFile->col_offset;
+      int end_rx   = rsize;
+      if (wrap)
+      {
+        // Screen lines after the first one continue where the last one ended
+        if (wrap_rx < 0)
+        {
+          editorWrapSpan(gCurFile, i, sub, &start_rx, &end_rx);
+        }
+        else
+        {
+          start_rx = wrap_rx;
+          end_rx   = editorWrapEnd(gCurFile, i, start_rx);
+        }
+        wrap_rx = end_rx;
+      }
+      int col_offset = editorRowRxToCx(&gCurFile->row[i], start_rx);
       len            = gCurFile->row[i].size - col_offset;
       len            = (len < 0) ? 0 : len;
 
       // Calculate rendered line length
-      int rlen    = gCurFile->row[i].rsize - gCurFile->col_offset;
+      int rlen    = end_rx - start_rx;
       is_row_full = (rlen > cols);
       rlen        = is_row_full ? cols : rlen;
-      rlen += gCurFile->col_offset;
+      rlen += start_rx;
 
       // Get pointers to character data and highlight info
       char    *c       = &gCurFile->row[i].data[col_offset];
       uint8_t *hl      = &(gCurFile->row[i].hl[col_offset]);
+      bool     ascii   = gCurFile->row[i].flags & ROW_ASCII;
       uint8_t  curr_fg = HL_BG_NORMAL;
       uint8_t  curr_bg = HL_NORMAL;
 
       // Set initial colors
-      setColor(ab, gEditor.color_cfg.highlightFg[curr_fg], 0);
-      setColor(ab, gEditor.color_cfg.highlightBg[curr_bg], 1);
+      screenSetColor(&gEditor.color_cfg.highlightFg[curr_fg], 0);
+      screenSetColor(bg_colors[curr_bg], 1);
+
+      // Other rows are decoded a chunk at a time, one entry per character
+      UnicodeChar chars[UTF8_SPAN_CHUNK];
+      size_t      decoded = 0;
+      size_t      next    = 0;
 
       // Draw each character in the row
       int j  = 0;
-      int rx = gCurFile->col_offset;
+      int rx = start_rx;
       while (rx < rlen)
       {
+        const UnicodeChar *ch = NULL;
+        if (!ascii)
+        {
+          if (next == decoded)
+          {
+            decoded = decodeUTF8Span(&c[j], len - j, chars, UTF8_SPAN_CHUNK);
+            next    = 0;
+            if (decoded == 0)
+              break;
+          }
+          ch = &chars[next++];
+        }
+
         // Handle control characters (except tab)
         if (iscntrl((uint8_t) c[j]) && c[j] != '\t')
         {
           // Display as caret notation (e.g., ^A for Ctrl-A)
           char sym = (c[j] <= 26) ? '@' + c[j] : '?';
-          abufAppendStr(ab, ANSI_INVERT);
-          abufAppendN(ab, &sym, 1);
-          abufAppendStr(ab, ANSI_CLEAR);
-          setColor(ab, gEditor.color_cfg.highlightFg[curr_fg], 0);
-          setColor(ab, gEditor.color_cfg.highlightBg[curr_bg], 1);
+          screenSetAttr(SCREEN_ATTR_INVERT);
+          screenPutN(&sym, 1);
+          screenResetColor();
+          screenSetColor(&gEditor.color_cfg.highlightFg[curr_fg], 0);
+          screenSetColor(bg_colors[curr_bg], 1);
 
           rx++;
           j++;
@@ -497,13 +600,13 @@ static void editorDrawRows(abuf *ab)
           }
           
           // Highlight spaces/tabs if drawspace is enabled
-          if (CONVAR_GETINT(drawspace) && (c[j] == ' ' || c[j] == '\t'))
+          if (drawspace && (c[j] == ' ' || c[j] == '\t'))
           {
             fg = HL_SPACE;
           }
           
           // Don't show trailing whitespace highlight if disabled
-          if (bg == HL_BG_TRAILING && !CONVAR_GETINT(trailing))
+          if (bg == HL_BG_TRAILING && !trailing)
           {
             bg = HL_BG_NORMAL;
           }
@@ -512,27 +615,27 @@ static void editorDrawRows(abuf *ab)
           if (fg != curr_fg)
           {
             curr_fg = fg;
-            setColor(ab, gEditor.color_cfg.highlightFg[fg], 0);
+            screenSetColor(&gEditor.color_cfg.highlightFg[fg], 0);
           }
           
           // Update background color if changed
           if (bg != curr_bg)
           {
             curr_bg = bg;
-            setColor(ab, gEditor.color_cfg.highlightBg[bg], 1);
+            screenSetColor(bg_colors[bg], 1);
           }
 
           // Handle tab characters
           if (c[j] == '\t')
           {
             // Show tab indicator if drawspace enabled
-            if (CONVAR_GETINT(drawspace))
+            if (drawspace)
             {
-              abufAppendN(ab, "|", 1);
+              screenPutN("|", 1);
             }
             else
             {
-              abufAppendN(ab, " ", 1);
+              screenPutN(" ", 1);
             }
 
             rx++;
@@ -540,7 +643,7 @@ static void editorDrawRows(abuf *ab)
             // Fill to next tab stop
             while (rx % CONVAR_GETINT(tabsize) != 0 && rx < rlen)
             {
-              abufAppendN(ab, " ", 1);
+              screenPutN(" ", 1);
               rx++;
             }
             j++;
@@ -549,29 +652,38 @@ static void editorDrawRows(abuf *ab)
           else if (c[j] == ' ')
           {
             // Show dot if drawspace enabled
-            if (CONVAR_GETINT(drawspace))
+            if (drawspace)
             {
-              abufAppendN(ab, ".", 1);
+              screenPutN(".", 1);
             }
             else
             {
-              abufAppendN(ab, " ", 1);
+              screenPutN(" ", 1);
             }
             rx++;
             j++;
           }
+          // ASCII rows have one byte per column
+          else if (ascii)
+          {
+            screenPutN(&c[j], 1);
+            rx++;
+            j++;
+          }
           // Handle regular UTF-8 characters
           else
           {
-            size_t   byte_size;
-            uint32_t unicode = decodeUTF8(&c[j], len - j, &byte_size);
-            int      width   = unicodeWidth(unicode);
+            size_t byte_size = ch->byte_size;
+            int    width     = ch->width;
             if (width >= 0)
             {
               rx += width;
-              // Make sure double-width chars don't exceed screen
+              // Make sure double-width chars don't exceed screen, pad the
+              // last column instead
               if (rx <= rlen)
-                abufAppendN(ab, &c[j], byte_size);
+                screenPutN(&c[j], byte_size);
+              else
+                screenPutStr(" ");
             }
             j += byte_size;
           }
@@ -580,24 +692,31 @@ static void editorDrawRows(abuf *ab)
 
       // Add newline character highlighting when line is selected
       if (gCurFile->cursor.is_selected && range.end_y > i && i >= range.start_y &&
-          gCurFile->row[i].rsize - gCurFile->col_offset < cols)
+          end_rx == rsize && rsize - start_rx < cols)
       {
-        setColor(ab, gEditor.color_cfg.highlightBg[HL_BG_SELECT], 1);
-        abufAppendN(ab, " ", 1);
+        screenSetColor(bg_colors[HL_BG_SELECT], 1);
+        screenPutN(" ", 1);
       }
-      setColor(ab, gEditor.color_cfg.highlightBg[HL_BG_NORMAL], 1);
+      screenSetColor(bg_colors[HL_BG_NORMAL], 1);
     }
     
     // Erase rest of line if row isn't full width
     if (!is_row_full)
-      abufAppendStr(ab, ANSI_ERASE_LINE);
-    setColor(ab, gEditor.color_cfg.bg, 1);
+      screenEraseLine();
+    screenSetColor(&gEditor.color_cfg.bg, 1);
+
+    // Go to the next screen line of the row, or the next row
+    if (!wrap || i >= gCurFile->num_rows || ++sub >= gCurFile->wrap.lines[i])
+    {
+      i++;
+      sub     = 0;
+      wrap_rx = 0;
+    }
   }
 }
 
 /**
  * editorDrawFileExplorer - Draw the file explorer sidebar
- * @ab: Append buffer to write to
  * 
  * Draws the file explorer panel showing:
  * - Explorer header
@@ -605,20 +724,20 @@ static void editorDrawRows(abuf *ab)
  * - Current selection highlight
  * - File/folder icons and colors
  */
-static void editorDrawFileExplorer(abuf *ab)
+static void editorDrawFileExplorer(void)
 {
   char *explorer_buf = malloc_s(gEditor.explorer.width + 1);
-  gotoXY(ab, 1, 1);
+  screenMoveTo(1, 1);
 
   // Draw explorer header
-  setColor(ab, gEditor.color_cfg.explorer[3], 0);
+  screenSetColor(&gEditor.color_cfg.explorer[3], 0);
   if (gEditor.state == EXPLORER_MODE)
-    setColor(ab, gEditor.color_cfg.explorer[4], 1);  // Highlight if in explorer mode
+    screenSetColor(&gEditor.color_cfg.explorer[4], 1);  // Highlight if in explorer mode
   else
-    setColor(ab, gEditor.color_cfg.explorer[0], 1);
+    screenSetColor(&gEditor.color_cfg.explorer[0], 1);
 
   snprintf(explorer_buf, gEditor.explorer.width + 1, " EXPLORER%*s", gEditor.explorer.width, "");
-  abufAppendN(ab, explorer_buf, gEditor.explorer.width);
+  screenPutN(explorer_buf, gEditor.explorer.width);
 
   // Calculate how many lines to display
   int lines = gEditor.explorer.flatten.size - gEditor.explorer.offset;
@@ -634,94 +753,104 @@ static void editorDrawFileExplorer(abuf *ab)
   // Draw each visible explorer entry
   for (int i = 0; i < lines; i++)
   {
-    gotoXY(ab, i + 2, 1);
+    screenMoveTo(i + 2, 1);
 
     int                 index = gEditor.explorer.offset + i;
     EditorExplorerNode *node  = gEditor.explorer.flatten.data[index];
     
     // Highlight selected entry
     if (index == gEditor.explorer.selected_index)
-      setColor(ab, gEditor.color_cfg.explorer[1], 1);
+      screenSetColor(&gEditor.color_cfg.explorer[1], 1);
     else
-      setColor(ab, gEditor.color_cfg.explorer[0], 1);
+      screenSetColor(&gEditor.color_cfg.explorer[0], 1);
 
     // Set icon based on file type and state
     const char *icon = "";
     if (node->is_directory)
     {
-      setColor(ab, gEditor.color_cfg.explorer[2], 0);
+      screenSetColor(&gEditor.color_cfg.explorer[2], 0);
       icon = node->is_open ? "v " : "> ";  // Expanded vs collapsed
     }
     else
     {
-      setColor(ab, gEditor.color_cfg.explorer[3], 0);
+      screenSetColor(&gEditor.color_cfg.explorer[3], 0);
     }
     
     const char *filename = getBaseName(node->filename);
 
-    // Format with indentation based on depth
-    snprintf(explorer_buf, gEditor.explorer.width + 1, "%*s%s%s%*s", node->depth * 2, "", icon,
-             filename, gEditor.explorer.width, "");
-    abufAppendN(ab, explorer_buf, gEditor.explorer.width);
+    // Format with indentation based on depth, open directories still being listed get a marker
+    const char *loading = (node->is_open && node->loading && !node->loaded) ? " ..." : "";
+    snprintf(explorer_buf, gEditor.explorer.width + 1, "%*s%s%s%s%*s", node->depth * 2, "", icon,
+             filename, loading, gEditor.explorer.width, "");
+    screenPutN(explorer_buf, gEditor.explorer.width);
   }
 
   // Draw blank lines to fill rest of explorer panel
-  setColor(ab, gEditor.color_cfg.explorer[0], 1);
-  setColor(ab, gEditor.color_cfg.explorer[3], 0);
+  screenSetColor(&gEditor.color_cfg.explorer[0], 1);
+  screenSetColor(&gEditor.color_cfg.explorer[3], 0);
+
+  if (lines == 0 && gEditor.display_rows > 0 && gEditor.explorer.node &&
+      gEditor.explorer.node->loading)
+  {
+    screenMoveTo(2, 1);
+    snprintf(explorer_buf, gEditor.explorer.width + 1, "  ...%*s", gEditor.explorer.width, "");
+    screenPutN(explorer_buf, gEditor.explorer.width);
+    lines = 1;
+  }
 
   memset(explorer_buf, ' ', gEditor.explorer.width);
 
   for (int i = 0; i < gEditor.display_rows - lines; i++)
   {
-    gotoXY(ab, lines + i + 2, 1);
-    abufAppendN(ab, explorer_buf, gEditor.explorer.width);
+    screenMoveTo(lines + i + 2, 1);
+    screenPutN(explorer_buf, gEditor.explorer.width);
   }
 
   free(explorer_buf);
 }
 
 /**
- * editorRefreshScreen - Refresh the entire screen display
- * 
- * Main rendering function that draws all UI elements:
- * - Top status bar with tabs
- * - Text editor content area
- * - File explorer sidebar
- * - Console messages
- * - Command prompt
- * - Bottom status bar
- * - Cursor positioning
- * 
- * Called whenever the screen needs to be redrawn.
+ * editorDrawScreen - Draw all UI elements into the back buffer
+ * @cursor_row: Set to the cursor row
+ * @cursor_col: Set to the cursor column
+ * @show_cursor: Set to whether the cursor is visible
  */
-void editorRefreshScreen(void)
+static void editorDrawScreen(int *cursor_row, int *cursor_col, bool *show_cursor)
 {
-  abuf ab = ABUF_INIT;
-
-  // Hide cursor and reset position during drawing
-  abufAppendStr(&ab, ANSI_CURSOR_HIDE ANSI_CURSOR_RESET_POS);
+  screenBeginFrame();
 
-  // Draw all UI components
-  editorDrawTopStatusBar(&ab);
-  editorDrawRows(&ab);
-  editorDrawFileExplorer(&ab);
+  // Draw all UI components into the back buffer
+  editorDrawTopStatusBar();
+  editorDrawRows();
+  editorDrawFileExplorer();
 
-  editorDrawConMsg(&ab);
-  editorDrawPrompt(&ab);
+  editorDrawConMsg();
+  editorDrawFinder();
+  editorDrawPrompt();
 
-  editorDrawStatusBar(&ab);
+  editorDrawStatusBar();
 
   // Calculate cursor position
   bool should_show_cursor = true;
+  *cursor_row             = 0;
+  *cursor_col             = 0;
   if (gEditor.state == EDIT_MODE)
   {
     // Calculate screen row (offset from top, accounting for status bar)
     int row = (gCurFile->cursor.y - gCurFile->row_offset) + 2;
     
     // Calculate screen column (accounting for tabs, explorer, line numbers)
-    int col = (editorRowCxToRx(&gCurFile->row[gCurFile->cursor.y], gCurFile->cursor.x) -
-               gCurFile->col_offset) +
-              1 + LILEX_WIDTH();
+    int rx  = editorRowCxToRx(&gCurFile->row[gCurFile->cursor.y], gCurFile->cursor.x);
+    int col = (rx - gCurFile->col_offset) + 1 + LILEX_WIDTH();
+
+    // Wrap mode counts screen lines, and columns from the start of the line
+    if (editorWrapReady(gCurFile))
+    {
+      int start, end;
+      int sub = editorWrapFindRx(gCurFile, gCurFile->cursor.y, rx, &start, &end);
+      row     = editorWrapLineOf(gCurFile, gCurFile->cursor.y) + sub - editorWrapTop(gCurFile) + 2;
+      col     = (rx - start) + 1 + LILEX_WIDTH();
+    }
     
     // Hide cursor if it's outside visible area
     if (row <= 1 || row > gEditor.screen_rows - 1 || col <= 0 ||
@@ -732,13 +861,15 @@ void editorRefreshScreen(void)
     }
     else
     {
-      gotoXY(&ab, row, col + gEditor.explorer.width);
+      *cursor_row = row;
+      *cursor_col = col + gEditor.explorer.width;
     }
   }
   else
   {
     // In prompt mode, position cursor in prompt area
-    gotoXY(&ab, gEditor.screen_rows - 1, gEditor.px + 1);
+    *cursor_row = gEditor.screen_rows - 1;
+    *cursor_col = gEditor.px + 1;
   }
 
   // Hide cursor in explorer mode
@@ -747,20 +878,96 @@ void editorRefreshScreen(void)
     should_show_cursor = false;
   }
 
-  // Show or hide cursor based on calculated state
-  if (should_show_cursor)
+  *show_cursor = should_show_cursor;
+}
+
+// Time of the last frame, for the maxfps limit
+static int64_t last_refresh_time = 0;
+
+/**
+ * editorRefreshScreen - Refresh the entire screen display
+ * 
+ * Main rendering function that draws all UI elements:
+ * - Top status bar with tabs
+ * - Text editor content area
+ * - File explorer sidebar
+ * - Console messages
+ * - Command prompt
+ * - Bottom status bar
+ * - Cursor positioning
+ * 
+ * Called whenever the screen needs to be redrawn.
+ */
+void editorRefreshScreen(void)
+{
+  int  cursor_row, cursor_col;
+  bool show_cursor;
+  editorDrawScreen(&cursor_row, &cursor_col, &show_cursor);
+
+  // Rows of the text area shift when the view of the same file scrolled
+  static const EditorFile *last_file       = NULL;
+  static int               last_row_offset = 0;
+  int row_offset = gCurFile->row_offset;
+  if (gEditor.file_count != 0 && editorWrapReady(gCurFile))
+    row_offset = editorWrapTop(gCurFile);
+  if (gCurFile == last_file && row_offset != last_row_offset)
+    screenScroll(2, gEditor.display_rows + 1, row_offset - last_row_offset);
+  last_file       = gCurFile;
+  last_row_offset = row_offset;
+
+  // Write the cells that changed since the last frame
+  screenFlush(cursor_row, cursor_col, show_cursor);
+  last_refresh_time = getTime();
+}
+
+void editorUpdateScreen(void)
+{
+  int     fps      = CONVAR_GETINT(maxfps);
+  int64_t interval = (fps > 0) ? 1000000 / fps : 0;
+  int64_t elapsed  = getTime() - last_refresh_time;
+
+  if (elapsed < interval)
   {
-    abufAppendStr(&ab, ANSI_CURSOR_SHOW);
+    // Keep handling input until the next frame is due
+    if (editorInputPending((interval - elapsed + 999) / 1000))
+      return;
   }
-  else
+  else if (fps <= 0 && editorInputPending(0))
+  {
+    return;
+  }
+
+  editorRefreshScreen();
+}
+
+#ifdef _DEBUG
+
+void editorBenchRefreshScreen(int frames, int64_t *draw_time, int64_t *render_time)
+{
+  *draw_time   = 0;
+  *render_time = 0;
+
+  for (int i = 0; i < frames; i++)
   {
-    abufAppendStr(&ab, ANSI_CURSOR_HIDE);
+    int  cursor_row, cursor_col;
+    bool show_cursor;
+    abuf ab = ABUF_INIT;
+
+    int64_t start = getTime();
+    editorDrawScreen(&cursor_row, &cursor_col, &show_cursor);
+    int64_t drawn = getTime();
+
+    // Emit every cell, the way a full redraw does
+    screenInvalidate();
+    screenRender(&ab, cursor_row, cursor_col, show_cursor);
+    *draw_time += drawn - start;
+    *render_time += getTime() - drawn;
+
+    abufFree(&ab);
   }
 
-  // Clear any remaining formatting
-  abufAppendStr(&ab, ANSI_CLEAR);
+  // The terminal doesn't show the last rendered frame
+  screenInvalidate();
+}
 
-  // Write everything to console at once
-  writeConsoleAll(ab.buf, ab.len);
-  abufFree(&ab);
-}
\ No newline at end of file
+#endif
@@ -37,8 +37,9 @@
  * 6. Bottom status bar with file info
  * 7. Positions the cursor appropriately
  *
- * All drawing is done to a buffer first, then written to the
- * terminal in one operation for smooth rendering without flicker.
+ * All drawing is done to a back buffer of cells first. Only the cells
+ * that differ from the previous frame are written to the terminal, in
+ * one operation for smooth rendering without flicker.
  *
  * This function is called after:
  * - User input (keypress, mouse action)
@@ -49,4 +50,24 @@
  */
 void editorRefreshScreen(void);
 
+/**
+ * editorUpdateScreen - Refresh the screen once the input is handled
+ *
+ * Used by input loops instead of editorRefreshScreen(). The frame is
+ * skipped while more input is waiting, so a burst of keys only draws its
+ * final state. Frames are at least 1000 / maxfps ms apart; during a long
+ * burst one frame is still drawn per interval to show progress.
+ */
+void editorUpdateScreen(void);
+
+#ifdef _DEBUG
+/**
+ * editorBenchRefreshScreen - Time building full frames without writing them
+ * @frames: Number of frames to build
+ * @draw_time: Set to the microseconds spent drawing into the back buffer
+ * @render_time: Set to the microseconds spent turning cells into output
+ */
+void editorBenchRefreshScreen(int frames, int64_t *draw_time, int64_t *render_time);
+#endif
+
 #endif
\ No newline at end of file
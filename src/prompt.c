@@ -131,7 +131,7 @@ char *editorPrompt(const char *prompt, int state, void (*callback)(char *, int))
   {
     // Update prompt with current input
     editorSetPrompt(prompt, buf);
-    editorRefreshScreen();
+    editorUpdateScreen();
 
     // Read user input
     EditorInput input = editorReadKey();
@@ -25,6 +25,46 @@ static inline bool ensureCapacity(size_t capacity, size_t size, size_t *new_capa
   return true;
 }
 
+// Tab size generation, column indices of older generations are stale
+static uint32_t column_gen = 1;
+
+static void        editorRowUpdateColumns(EditorRow *row);
+static void        editorRowEditColumns(EditorRow *row, int at, int removed, int inserted);
+static inline void editorRowEnsureColumns(const EditorRow *row);
+
+/**
+ * rowColumnAt - Count the checkpoints of the column index at or before a position
+ * @row: The row, its column index must be up to date
+ * @cx: The position
+ */
+static int rowColumnAt(const EditorRow *row, int cx)
+{
+  // Checkpoints of a row edited in chunks have moved with the text
+  if (row->flags & ROW_CHUNKED)
+  {
+    int lo = 0;
+    int hi = row->column_count;
+    while (lo < hi)
+    {
+      int mid = (lo + hi) / 2;
+      if (row->columns[mid].cx <= cx)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+    return lo;
+  }
+
+  int k = (cx < 0) ? 0 : cx / ROW_COLUMN_STEP;
+  if (k > row->column_count)
+    k = row->column_count;
+  while (k > 0 && row->columns[k - 1].cx > cx)
+  {
+    k--;
+  }
+  return k;
+}
+
 static void editorRowEnsureCapacity(EditorRow *row, size_t size)
 {
   size_t new_capacity;
@@ -36,12 +76,105 @@ static void editorRowEnsureCapacity(EditorRow *row, size_t size)
   row->capacity = new_capacity;
 }
 
+/**
+ * scanRowFlags - Compute the ROW_* flags of text
+ * @data: The text
+ * @size: Length of the text
+ *
+ * Tests eight bytes at a time for set high bits, NUL bytes and tabs.
+ */
+static uint8_t scanRowFlags(const char *data, int size)
+{
+  const uint64_t ones  = 0x0101010101010101ULL;
+  const uint64_t highs = 0x8080808080808080ULL;
+  const uint64_t tabs  = ones * '\t';
+
+  uint64_t high = 0;
+  uint64_t zero = 0;
+  uint64_t tab  = 0;
+
+  int i = 0;
+  for (; i + 8 <= size; i += 8)
+  {
+    uint64_t w;
+    memcpy(&w, &data[i], 8);
+    uint64_t t = w ^ tabs;
+    high |= w;
+    zero |= (w - ones) & ~w;
+    tab |= (t - ones) & ~t;
+  }
+
+  for (; i < size; i++)
+  {
+    uint8_t c = data[i];
+    high |= c;
+    zero |= (c == 0) ? highs : 0;
+    tab |= (c == '\t') ? highs : 0;
+  }
+
+  uint8_t flags = 0;
+  if (((high | zero) & highs) == 0)
+    flags |= ROW_ASCII;
+  if (tab & highs)
+    flags |= ROW_TAB;
+  return flags;
+}
+
 void editorUpdateRow(EditorFile *file, EditorRow *row)
 {
-  row->rsize = editorRowCxToRx(row, row->size);
+  row->flags = scanRowFlags(row->data, row->size);
+  editorRowUpdateColumns(row);
+  editorWrapUpdateRow(file, row - file->row);
   editorUpdateSyntax(file, row);
 }
 
+bool editorRowIsLong(const EditorRow *row)
+{
+  int64_t size = CONVAR_GETINT(longline_size);
+  return size > 0 && row->size >= size * 1024;
+}
+
+/**
+ * editorRowEdited - Update a row after text was replaced at a position
+ * @file: The file containing the row
+ * @row: The row, already edited
+ * @at: Position of the edit
+ * @removed: Bytes removed at @at
+ * @inserted: Bytes inserted at @at
+ * @rescan: The removed bytes may have taken ROW_* flags away
+ *
+ * Long rows only update the column index and the highlighting around the
+ * edit, see editorRowIsLong(). Other rows are updated as a whole.
+ */
+static void editorRowEdited(EditorFile *file, EditorRow *row, int at, int removed, int inserted,
+                            bool rescan)
+{
+  if (!editorRowIsLong(row))
+  {
+    editorUpdateRow(file, row);
+    return;
+  }
+
+  uint8_t flags = scanRowFlags(rescan ? row->data : &row->data[at], rescan ? row->size : inserted);
+  if (!rescan)
+    flags = (row->flags & flags & ROW_ASCII) | ((row->flags | flags) & ROW_TAB);
+
+  // Columns of ASCII rows without tabs are the byte offsets
+  bool was_plain = (row->flags & (ROW_ASCII | ROW_TAB)) == ROW_ASCII;
+  bool plain     = (flags & (ROW_ASCII | ROW_TAB)) == ROW_ASCII;
+  row->flags     = flags | (row->flags & ROW_CHUNKED);
+
+  if (plain && was_plain)
+    row->rsize = row->size;
+  else if (plain != was_plain || row->column_gen != column_gen)
+    editorRowUpdateColumns(row);
+  else
+    editorRowEditColumns(row, at, removed, inserted);
+
+  editorWrapUpdateRow(file, row - file->row);
+  editorUpdateSyntaxEdit(file, row, at, removed, inserted);
+}
+
 void editorInsertRow(EditorFile *file, int at, const char *s, size_t len)
 {
   if (at < 0 || at > file->num_rows)
@@ -50,32 +183,78 @@ void editorInsertRow(EditorFile *file, int at, const char *s, size_t len)
   size_t new_capacity;
   if (ensureCapacity(file->row_capacity, file->num_rows + 1, &new_capacity))
   {
-    file->row = realloc_s(file->row, sizeof(EditorRow) * new_capacity);
+    file->row          = realloc_s(file->row, sizeof(EditorRow) * new_capacity);
+    file->row_capacity = new_capacity;
   }
 
   memmove(&file->row[at + 1], &file->row[at], sizeof(EditorRow) * (file->num_rows - at));
   memset(&file->row[at], 0, sizeof(EditorRow));
-  editorRowAppendString(file, &file->row[at], s, len);
 
   file->num_rows++;
   file->lilex_width = getDigit(file->num_rows) + 2;
+  editorWrapInsertRows(file, at, 1);
+
+  editorRowAppendString(file, &file->row[at], s, len);
+}
+
+void editorInsertRows(EditorFile *file, int at, const Str *lines, size_t count)
+{
+  if (at < 0 || at > file->num_rows || count == 0)
+    return;
+
+  size_t new_capacity;
+  if (ensureCapacity(file->row_capacity, file->num_rows + count, &new_capacity))
+  {
+    file->row          = realloc_s(file->row, sizeof(EditorRow) * new_capacity);
+    file->row_capacity = new_capacity;
+  }
+
+  memmove(&file->row[at + count], &file->row[at], sizeof(EditorRow) * (file->num_rows - at));
+  memset(&file->row[at], 0, sizeof(EditorRow) * count);
+
+  file->num_rows += count;
+  file->lilex_width = getDigit(file->num_rows) + 2;
+  editorWrapInsertRows(file, at, count);
+
+  // Fill every row first, the highlighting of a row runs into the next ones
+  for (size_t i = 0; i < count; i++)
+  {
+    EditorRow *row = &file->row[at + i];
+    editorRowEnsureCapacity(row, lines[i].size);
+    memcpy(row->data, lines[i].data, lines[i].size);
+    row->size = lines[i].size;
+  }
+  for (size_t i = 0; i < count; i++)
+  {
+    editorUpdateRow(file, &file->row[at + i]);
+  }
 }
 
 void editorFreeRow(EditorRow *row)
 {
   free(row->data);
   free(row->hl);
+  free(row->hl_chunks);
+  free(row->columns);
 }
 
 void editorDelRow(EditorFile *file, int at)
 {
   if (at < 0 || at >= file->num_rows)
     return;
+
+  uint64_t state = file->row[at].hl_state;
   editorFreeRow(&file->row[at]);
   memmove(&file->row[at], &file->row[at + 1], sizeof(EditorRow) * (file->num_rows - at - 1));
 
   file->num_rows--;
   file->lilex_width = getDigit(file->num_rows) + 2;
+  editorWrapDeleteRows(file, at, 1);
+
+  // The next row now continues from the previous row's state
+  uint64_t prev_state = at > 0 ? file->row[at - 1].hl_state : 0;
+  if (at < file->num_rows && prev_state != state)
+    editorUpdateSyntax(file, &file->row[at]);
 }
 
 void editorRowInsertChar(EditorFile *file, EditorRow *row, int at, int c)
@@ -86,16 +265,17 @@ void editorRowInsertChar(EditorFile *file, EditorRow *row, int at, int c)
   memmove(&row->data[at + 1], &row->data[at], row->size - at);
   row->size++;
   row->data[at] = c;
-  editorUpdateRow(file, row);
+  editorRowEdited(file, row, at, 0, 1, false);
 }
 
 void editorRowDelChar(EditorFile *file, EditorRow *row, int at)
 {
   if (at < 0 || at >= row->size)
     return;
+  uint8_t c = row->data[at];
   memmove(&row->data[at], &row->data[at + 1], row->size - at - 1);
   row->size--;
-  editorUpdateRow(file, row);
+  editorRowEdited(file, row, at, 1, 0, c == '\t' || c == '\0' || c >= 0x80);
 }
 
 void editorRowAppendString(EditorFile *file, EditorRow *row, const char *s, size_t len)
@@ -103,7 +283,7 @@ void editorRowAppendString(EditorFile *file, EditorRow *row, const char *s, size
   editorRowEnsureCapacity(row, row->size + len);
   memcpy(&row->data[row->size], s, len);
   row->size += len;
-  editorUpdateRow(file, row);
+  editorRowEdited(file, row, row->size - len, 0, len, false);
 }
 
 void editorRowInsertString(EditorFile *file, EditorRow *row, int at, const char *s, size_t len)
@@ -115,7 +295,7 @@ void editorRowInsertString(EditorFile *file, EditorRow *row, int at, const char
   memmove(&row->data[at + len], &row->data[at], row->size - at);
   memcpy(&row->data[at], s, len);
   row->size += len;
-  editorUpdateRow(file, row);
+  editorRowEdited(file, row, at, 0, len, false);
 }
 
 void editorInsertChar(int c)
@@ -229,6 +409,9 @@ int editorRowNextUTF8(EditorRow *row, int cx)
   if (cx >= row->size)
     return row->size;
 
+  if (row->flags & ROW_ASCII)
+    return cx + 1;
+
   const char *s = &row->data[cx];
   size_t      byte_size;
   decodeUTF8(s, row->size - cx, &byte_size);
@@ -243,7 +426,14 @@ int editorRowPreviousUTF8(EditorRow *row, int cx)
   if (cx > row->size)
     return row->size;
 
-  int    i         = 0;
+  if (row->flags & ROW_ASCII)
+    return cx - 1;
+
+  // Decode from the last checkpoint before cx, which is a character boundary
+  editorRowEnsureColumns(row);
+  int k = rowColumnAt(row, cx - 1);
+
+  int    i         = k ? row->columns[k - 1].cx : 0;
   size_t byte_size = 0;
   while (i < cx)
   {
@@ -253,49 +443,289 @@ int editorRowPreviousUTF8(EditorRow *row, int cx)
   return i - byte_size;
 }
 
-int editorRowCxToRx(const EditorRow *row, int cx)
+static inline int charColumns(uint32_t unicode, int rx, int tabsize)
+{
+  if (unicode == '\t')
+    return tabsize - (rx % tabsize);
+
+  int width = unicodeWidth(unicode);
+  return (width < 0) ? 1 : width;
+}
+
+/**
+ * rowWalk - Get the rendered column of a position from an earlier one
+ * @row: The row
+ * @i: Character boundary to start from
+ * @rx: Rendered column of @i
+ * @cx: The position
+ */
+static int rowWalk(const EditorRow *row, int i, int rx, int cx)
 {
-  int rx = 0;
-  int i  = 0;
+  int tabsize = CONVAR_GETINT(tabsize);
+  if (row->flags & ROW_ASCII)
+  {
+    for (; i < cx; i++)
+    {
+      rx += (row->data[i] == '\t') ? tabsize - (rx % tabsize) : 1;
+    }
+    return rx;
+  }
+
   while (i < cx)
   {
     size_t   byte_size;
     uint32_t unicode = decodeUTF8(&row->data[i], row->size - i, &byte_size);
-    if (unicode == '\t')
+    rx += charColumns(unicode, rx, tabsize);
+    i += byte_size;
+  }
+  return rx;
+}
+
+/**
+ * editorRowUpdateColumns - Rebuild the column index and rendered size
+ * @row: The row
+ *
+ * Stores a checkpoint every ROW_COLUMN_STEP bytes, so column lookups only
+ * decode from the nearest checkpoint instead of the start of the row.
+ */
+static void editorRowUpdateColumns(EditorRow *row)
+{
+  // Columns of ASCII rows without tabs are the byte offsets
+  bool plain = (row->flags & (ROW_ASCII | ROW_TAB)) == ROW_ASCII;
+  int  count = plain ? 0 : row->size / ROW_COLUMN_STEP;
+  if (count != row->column_count)
+  {
+    free(row->columns);
+    row->columns      = count ? malloc_s(count * sizeof(RowColumn)) : NULL;
+    row->column_count = count;
+  }
+
+  row->column_gen = column_gen;
+  row->flags &= ~ROW_CHUNKED;
+  if (plain)
+  {
+    row->rsize = row->size;
+    return;
+  }
+
+  int  tabsize = CONVAR_GETINT(tabsize);
+  bool ascii   = row->flags & ROW_ASCII;
+  int  rx      = 0;
+  int  cx      = 0;
+  int  k       = 0;
+
+  // Characters are decoded a chunk at a time
+  UnicodeChar chars[UTF8_SPAN_CHUNK];
+  size_t      decoded = 0;
+  size_t      next    = 0;
+
+  while (cx < row->size)
+  {
+    while (k < count && cx >= (k + 1) * ROW_COLUMN_STEP)
     {
-      rx += (CONVAR_GETINT(tabsize) - 1) - (rx % CONVAR_GETINT(tabsize)) + 1;
+      row->columns[k++] = (RowColumn){cx, rx};
     }
-    else
+
+    if (ascii)
     {
-      int width = unicodeWidth(unicode);
-      if (width < 0)
-        width = 1;
-      rx += width;
+      rx += (row->data[cx] == '\t') ? tabsize - (rx % tabsize) : 1;
+      cx++;
+      continue;
     }
-    i += byte_size;
+
+    if (next == decoded)
+    {
+      decoded = decodeUTF8Span(&row->data[cx], row->size - cx, chars, UTF8_SPAN_CHUNK);
+      next    = 0;
+    }
+
+    const UnicodeChar *ch = &chars[next++];
+    if (ch->unicode == '\t')
+      rx += tabsize - (rx % tabsize);
+    else
+      rx += (ch->width < 0) ? 1 : ch->width;
+    cx += ch->byte_size;
   }
-  return rx;
+
+  while (k < count)
+  {
+    row->columns[k++] = (RowColumn){cx, rx};
+  }
+
+  row->rsize = rx;
 }
 
-int editorRowRxToCx(const EditorRow *row, int rx)
+/**
+ * editorRowEditColumns - Update the column index after an edit
+ * @row: The row, already edited, with the column index from before the edit
+ * @at: Position of the edit
+ * @removed: Bytes removed at @at
+ * @inserted: Bytes inserted at @at
+ *
+ * Decodes again from the last checkpoint before the edit to the first old
+ * checkpoint after it that is still a character boundary, and moves the
+ * checkpoints after that one along with the text. They shift by the
+ * columns the edit added up to the first tab, which rounds the shift to a
+ * multiple of the tab size.
+ */
+static void editorRowEditColumns(EditorRow *row, int at, int removed, int inserted)
 {
-  int cur_rx = 0;
-  int cx     = 0;
+  RowColumn *old   = row->columns;
+  int        count = row->column_count;
+  int        delta = inserted - removed;
+
+  // A character starting up to 3 bytes before the edit may decode differently
+  int keep = rowColumnAt(row, at - 4);
+  int sync = rowColumnAt(row, at + removed + 3);
+  int cx   = keep ? old[keep - 1].cx : 0;
+  int rx   = keep ? old[keep - 1].rx : 0;
+  int last = cx;
+
+  int  tabsize = CONVAR_GETINT(tabsize);
+  bool ascii   = row->flags & ROW_ASCII;
+
+  VECTOR(RowColumn) walked = {0};
   while (cx < row->size)
   {
+    while (sync < count && old[sync].cx + delta < cx)
+    {
+      sync++;
+    }
+    if (sync < count && old[sync].cx + delta == cx)
+      break;
+
+    if (cx >= last + ROW_COLUMN_STEP)
+    {
+      vector_push(walked, ((RowColumn){cx, rx}));
+      last = cx;
+    }
+
+    if (ascii)
+    {
+      rx += (row->data[cx] == '\t') ? tabsize - (rx % tabsize) : 1;
+      cx++;
+      continue;
+    }
+
     size_t   byte_size;
     uint32_t unicode = decodeUTF8(&row->data[cx], row->size - cx, &byte_size);
-    if (unicode == '\t')
+    rx += charColumns(unicode, rx, tabsize);
+    cx += byte_size;
+  }
+
+  bool synced = (cx < row->size);
+  int  tail   = synced ? count - sync : 0;
+  int  shift  = synced ? rx - old[sync].rx : 0;
+  int  after  = shift;
+  int  tab    = row->size;
+
+  // The first tab after the edit absorbs a shift that is not a multiple
+  // of the tab size
+  if (synced && shift % tabsize != 0 && (row->flags & ROW_TAB))
+  {
+    const char *found = memchr(&row->data[cx], '\t', row->size - cx);
+    if (found)
     {
-      cur_rx += (CONVAR_GETINT(tabsize) - 1) - (cur_rx % CONVAR_GETINT(tabsize)) + 1;
+      tab   = found - row->data;
+      int m = sync;
+      while (m + 1 < count && old[m + 1].cx + delta <= tab)
+      {
+        m++;
+      }
+
+      int old_rx = rowWalk(row, old[m].cx + delta, old[m].rx, tab);
+      int new_rx = old_rx + shift;
+      after      = (new_rx + tabsize - new_rx % tabsize) - (old_rx + tabsize - old_rx % tabsize);
     }
+  }
+
+  int        walked_count = (int) walked.size;
+  int        new_count    = keep + walked_count + tail;
+  RowColumn *columns      = new_count ? malloc_s(new_count * sizeof(RowColumn)) : NULL;
+  if (keep)
+    memcpy(columns, old, keep * sizeof(RowColumn));
+  if (walked_count)
+    memcpy(&columns[keep], walked.data, walked_count * sizeof(RowColumn));
+  for (int i = 0; i < tail; i++)
+  {
+    RowColumn column = old[sync + i];
+    column.cx += delta;
+    column.rx += (column.cx > tab) ? after : shift;
+    columns[keep + walked_count + i] = column;
+  }
+
+  row->rsize        = synced ? row->rsize + after : rx;
+  row->columns      = columns;
+  row->column_count = new_count;
+  row->flags |= ROW_CHUNKED;
+  free(walked.data);
+  free(old);
+}
+
+static inline void editorRowEnsureColumns(const EditorRow *row)
+{
+  // The index is a cache, rebuilding it leaves the row content untouched
+  if (row->column_gen != column_gen)
+    editorRowUpdateColumns((EditorRow *) row);
+}
+
+void editorRowInvalidateColumns(void)
+{
+  column_gen++;
+}
+
+int editorRowCxToRx(const EditorRow *row, int cx)
+{
+  if ((row->flags & (ROW_ASCII | ROW_TAB)) == ROW_ASCII && cx <= row->size)
+    return cx;
+
+  editorRowEnsureColumns(row);
+  if (cx == row->size)
+    return row->rsize;
+
+  // Start from the last checkpoint at or before cx
+  int k = rowColumnAt(row, cx);
+  return rowWalk(row, k ? row->columns[k - 1].cx : 0, k ? row->columns[k - 1].rx : 0, cx);
+}
+
+int editorRowRxToCx(const EditorRow *row, int rx)
+{
+  if ((row->flags & (ROW_ASCII | ROW_TAB)) == ROW_ASCII)
+    return (rx < 0) ? 0 : (rx < row->size) ? rx : row->size;
+
+  editorRowEnsureColumns(row);
+
+  // Binary search the last checkpoint at or before rx
+  int lo = 0;
+  int hi = row->column_count;
+  while (lo < hi)
+  {
+    int mid = (lo + hi) / 2;
+    if (row->columns[mid].rx <= rx)
+      lo = mid + 1;
     else
+      hi = mid;
+  }
+
+  int tabsize = CONVAR_GETINT(tabsize);
+  int cur_rx  = lo ? row->columns[lo - 1].rx : 0;
+  int cx      = lo ? row->columns[lo - 1].cx : 0;
+  if (row->flags & ROW_ASCII)
+  {
+    for (; cx < row->size; cx++)
     {
-      int width = unicodeWidth(unicode);
-      if (width < 0)
-        width = 1;
-      cur_rx += width;
+      cur_rx += (row->data[cx] == '\t') ? tabsize - (cur_rx % tabsize) : 1;
+      if (cur_rx > rx)
+        return cx;
     }
+    return cx;
+  }
+
+  while (cx < row->size)
+  {
+    size_t   byte_size;
+    uint32_t unicode = decodeUTF8(&row->data[cx], row->size - cx, &byte_size);
+    cur_rx += charColumns(unicode, cur_rx, tabsize);
     if (cur_rx > rx)
       return cx;
     cx += byte_size;
@@ -1,9 +1,32 @@
 #ifndef ROW_H
 #define ROW_H
 
+#include "utils.h"
+
 struct EditorFile;
 typedef struct EditorFile EditorFile;
 
+// Bytes between two checkpoints of the column index
+#define ROW_COLUMN_STEP 256
+
+/**
+ * struct RowColumn - Checkpoint of the column index
+ * @cx: First character boundary at or after a multiple of ROW_COLUMN_STEP
+ * @rx: Rendered column of @cx
+ */
+typedef struct RowColumn
+{
+  int cx;
+  int rx;
+} RowColumn;
+
+/**
+ * Row flags, kept up to date on every change of the row
+ */
+#define ROW_ASCII (1 << 0)    // Only 7-bit characters without NUL, one byte per column
+#define ROW_TAB (1 << 1)      // Has a tab
+#define ROW_CHUNKED (1 << 2)  // Edited in chunks, checkpoints are not at multiples of the step
+
 typedef struct EditorRow
 {
   int      size;
@@ -11,11 +34,40 @@ typedef struct EditorRow
   char    *data;
   size_t   capacity;
   uint8_t *hl;
-  int      hl_open_comment;
+  uint64_t hl_state;
+  uint8_t  flags;
+
+  // Lexer states of a long row, see editorUpdateSyntaxEdit()
+  struct EditorHlChunks *hl_chunks;
+
+  // Column index, see editorRowCxToRx()
+  RowColumn *columns;
+  int        column_count;
+  uint32_t   column_gen;
 } EditorRow;
 
 void editorUpdateRow(EditorFile *file, EditorRow *row);
+
+/**
+ * editorRowIsLong - Check if a row is edited in chunks
+ * @row: The row
+ *
+ * An edit of a row of at least longline_size KB only updates the column
+ * index and the highlighting around it.
+ */
+bool editorRowIsLong(const EditorRow *row);
 void editorInsertRow(EditorFile *file, int at, const char *s, size_t len);
+
+/**
+ * editorInsertRows - Insert many rows at once
+ * @file: The file
+ * @at: Index of the first new row
+ * @lines: Text of the new rows
+ * @count: Number of @lines
+ *
+ * Moves the rows after @at once, not once per inserted row.
+ */
+void editorInsertRows(EditorFile *file, int at, const Str *lines, size_t count);
 void editorFreeRow(EditorRow *row);
 void editorDelRow(EditorFile *file, int at);
 void editorRowInsertChar(EditorFile *file, EditorRow *row, int at, int c);
@@ -34,7 +86,8 @@ int editorRowPreviousUTF8(EditorRow *row, int cx);
 int editorRowNextUTF8(EditorRow *row, int cx);
 
 // Cx Rx
-int editorRowCxToRx(const EditorRow *row, int cx);
-int editorRowRxToCx(const EditorRow *row, int rx);
+int  editorRowCxToRx(const EditorRow *row, int cx);
+int  editorRowRxToCx(const EditorRow *row, int rx);
+void editorRowInvalidateColumns(void);
 
 #endif
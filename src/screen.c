@@ -0,0 +1,728 @@
+#include "screen.h"
+
+#include "config.h"
+#include "editor.h"
+#include "terminal.h"
+#include "unicode.h"
+
+// Unchanged cells rewritten instead of moving the cursor over them
+#define SCREEN_SKIP_MAX 4
+
+// Blank cells at the end of a row cleared with one erase instead
+#define SCREEN_ERASE_MIN 8
+
+// Cells a scroll has to save to be worth the escape sequences
+#define SCREEN_SCROLL_MIN 16
+
+// Cell length that never matches, for rows the terminal left blank
+#define SCREEN_CELL_UNKNOWN 0xFF
+
+/**
+ * struct Screen - Front and back buffers of the renderer
+ * @rows: Screen height in cells
+ * @cols: Screen width in cells
+ * @front: What the terminal shows
+ * @back: The frame being drawn
+ * @invalid: The terminal content is unknown
+ * @row: Drawing row, 0-based
+ * @col: Drawing column, 0-based
+ * @fg: Drawing foreground color
+ * @bg: Drawing background color
+ * @attr: Drawing attributes
+ * @cursor_row: Cursor row of the last frame
+ * @cursor_col: Cursor column of the last frame
+ * @cursor_shown: Cursor visibility of the last frame
+ * @scroll_top: First row of the scroll hint, 0-based
+ * @scroll_bottom: Last row of the scroll hint, 0-based
+ * @scroll_n: Rows the content moved up, negative for down, 0 for no hint
+ * @out: Output of the frame, kept between frames to reuse its memory
+ * @stats: Output statistics
+ */
+typedef struct Screen
+{
+  int         rows;
+  int         cols;
+  ScreenCell *front;
+  ScreenCell *back;
+  bool        invalid;
+
+  int     row;
+  int     col;
+  uint8_t fg;
+  uint8_t bg;
+  uint8_t attr;
+
+  int  cursor_row;
+  int  cursor_col;
+  bool cursor_shown;
+
+  int scroll_top;
+  int scroll_bottom;
+  int scroll_n;
+
+  abuf out;
+
+  ScreenStats stats;
+} Screen;
+
+static Screen screen = {.invalid = true};
+
+// SGR parameters of each palette index, as foreground and as background
+static char    sgr_params[2][256][20];
+static uint8_t sgr_params_len[2][256];
+
+// First palette index with the same color, so equal colors compare equal
+static uint8_t palette_alias[EDITOR_PALETTE_SIZE];
+
+static inline bool cellEqual(const ScreenCell *a, const ScreenCell *b)
+{
+  return a->len == b->len && a->attr == b->attr && a->fg == b->fg && a->bg == b->bg &&
+         memcmp(a->glyph, b->glyph, a->len) == 0;
+}
+
+static inline ScreenCell *backCell(int row, int col)
+{
+  return &screen.back[row * screen.cols + col];
+}
+
+static inline ScreenCell *frontCell(int row, int col)
+{
+  return &screen.front[row * screen.cols + col];
+}
+
+static void setBlank(ScreenCell *cell)
+{
+  cell->glyph[0] = ' ';
+  cell->len      = 1;
+}
+
+void screenBeginFrame(void)
+{
+  int rows = gEditor.screen_rows;
+  int cols = gEditor.screen_cols;
+
+  if (rows != screen.rows || cols != screen.cols)
+  {
+    size_t count = (size_t) rows * cols;
+    free(screen.front);
+    free(screen.back);
+    screen.front   = malloc_s(count * sizeof(ScreenCell));
+    screen.back    = malloc_s(count * sizeof(ScreenCell));
+    screen.rows    = rows;
+    screen.cols    = cols;
+    screen.invalid = true;
+  }
+
+  ScreenCell blank = {.glyph = " ", .len = 1, .fg = SCREEN_DEFAULT_FG, .bg = SCREEN_DEFAULT_BG};
+  for (int i = 0; i < rows * cols; i++)
+  {
+    screen.back[i] = blank;
+  }
+
+  screen.row  = 0;
+  screen.col  = 0;
+  screen.fg   = SCREEN_DEFAULT_FG;
+  screen.bg   = SCREEN_DEFAULT_BG;
+  screen.attr = 0;
+}
+
+// Colors of the 16 color terminal palette, as xterm shows them
+static const Color ansi_colors[16] = {
+    {0x00, 0x00, 0x00}, {0xCD, 0x00, 0x00}, {0x00, 0xCD, 0x00}, {0xCD, 0xCD, 0x00},
+    {0x00, 0x00, 0xEE}, {0xCD, 0x00, 0xCD}, {0x00, 0xCD, 0xCD}, {0xE5, 0xE5, 0xE5},
+    {0x7F, 0x7F, 0x7F}, {0xFF, 0x00, 0x00}, {0x00, 0xFF, 0x00}, {0xFF, 0xFF, 0x00},
+    {0x5C, 0x5C, 0xFF}, {0xFF, 0x00, 0xFF}, {0x00, 0xFF, 0xFF}, {0xFF, 0xFF, 0xFF},
+};
+
+// Channel levels of the 6x6x6 color cube of the 256 color palette
+static const int cube_levels[6] = {0x00, 0x5F, 0x87, 0xAF, 0xD7, 0xFF};
+
+/**
+ * colorDistance - Distance between two colors as the eye sees it
+ *
+ * Weights the channels by the mean red level ("redmean").
+ */
+static int colorDistance(Color a, Color b)
+{
+  int mean = (a.r + b.r) / 2;
+  int dr   = a.r - b.r;
+  int dg   = a.g - b.g;
+  int db   = a.b - b.b;
+  return (((512 + mean) * dr * dr) >> 8) + 4 * dg * dg + (((767 - mean) * db * db) >> 8);
+}
+
+static int cubeIndex(int v)
+{
+  return (v < 48) ? 0 : (v < 115) ? 1 : (v - 35) / 40;
+}
+
+/**
+ * nearest256 - Find the nearest color of the 256 color palette
+ *
+ * Only the color cube and the gray ramp are searched, the first 16 colors
+ * differ between terminals.
+ */
+static int nearest256(Color c)
+{
+  int   r    = cubeIndex(c.r);
+  int   g    = cubeIndex(c.g);
+  int   b    = cubeIndex(c.b);
+  Color cube = {cube_levels[r], cube_levels[g], cube_levels[b]};
+
+  // Gray ramp from 8 to 238 in steps of 10
+  int level = (c.r + c.g + c.b) / 3;
+  int k     = (level < 8) ? 0 : (level - 3) / 10;
+  if (k > 23)
+    k = 23;
+  Color gray = {8 + k * 10, 8 + k * 10, 8 + k * 10};
+
+  if (colorDistance(c, gray) < colorDistance(c, cube))
+    return 232 + k;
+  return 16 + 36 * r + 6 * g + b;
+}
+
+static int nearest16(Color c)
+{
+  int best = 0;
+  for (int i = 1; i < 16; i++)
+  {
+    if (colorDistance(c, ansi_colors[i]) < colorDistance(c, ansi_colors[best]))
+      best = i;
+  }
+  return best;
+}
+
+/**
+ * colorParams - Write the SGR parameters of a color
+ * @c: The color
+ * @is_bg: Write the background parameters
+ * @mode: Colors of the terminal, 16, 256 or 0 for 24-bit color
+ * @buf: Output buffer of 20 bytes
+ *
+ * Returns: Length of the parameters
+ */
+static int colorParams(Color c, int is_bg, int mode, char *buf)
+{
+  // Black background is the terminal default background
+  if (is_bg && c.r == 0 && c.g == 0 && c.b == 0)
+    return snprintf(buf, 20, "49");
+
+  if (mode == 16)
+  {
+    int index = nearest16(c);
+    int base  = (index < 8) ? 30 : 90;
+    return snprintf(buf, 20, "%d", base + (is_bg ? 10 : 0) + index % 8);
+  }
+
+  if (mode == 256)
+    return snprintf(buf, 20, "%d;5;%d", is_bg ? 48 : 38, nearest256(c));
+
+  return snprintf(buf, 20, "%d;2;%d;%d;%d", is_bg ? 48 : 38, c.r, c.g, c.b);
+}
+
+static int colorMode(void)
+{
+  const char *option = CONVAR_GETSTR(colormode);
+  if (strcmp(option, "256") == 0)
+    return 256;
+  if (strcmp(option, "16") == 0)
+    return 16;
+  return 0;
+}
+
+void screenLoadPalette(void)
+{
+  const Color *colors = (const Color *) &gEditor.color_cfg;
+  int          mode   = colorMode();
+  for (size_t i = 0; i < EDITOR_PALETTE_SIZE; i++)
+  {
+    sgr_params_len[0][i] = colorParams(colors[i], 0, mode, sgr_params[0][i]);
+    sgr_params_len[1][i] = colorParams(colors[i], 1, mode, sgr_params[1][i]);
+
+    // Colors that map to the same output compare equal
+    palette_alias[i] = i;
+    for (size_t j = 0; j < i; j++)
+    {
+      if (strcmp(sgr_params[0][j], sgr_params[0][i]) == 0 &&
+          strcmp(sgr_params[1][j], sgr_params[1][i]) == 0)
+      {
+        palette_alias[i] = j;
+        break;
+      }
+    }
+  }
+
+  sgr_params_len[0][SCREEN_DEFAULT_FG] =
+      snprintf(sgr_params[0][SCREEN_DEFAULT_FG], sizeof(sgr_params[0][0]), "39");
+  sgr_params_len[1][SCREEN_DEFAULT_BG] =
+      snprintf(sgr_params[1][SCREEN_DEFAULT_BG], sizeof(sgr_params[1][0]), "49");
+
+  screen.invalid = true;
+}
+
+void screenMoveTo(int row, int col)
+{
+  screen.row = row - 1;
+  screen.col = (col > 0) ? col - 1 : 0;
+}
+
+void screenSetColor(const Color *color, int is_bg)
+{
+  uint8_t index = palette_alias[color - (const Color *) &gEditor.color_cfg];
+  if (is_bg)
+    screen.bg = index;
+  else
+    screen.fg = index;
+}
+
+void screenSetAttr(uint8_t attr)
+{
+  screen.attr = attr;
+}
+
+void screenResetColor(void)
+{
+  screen.fg   = SCREEN_DEFAULT_FG;
+  screen.bg   = SCREEN_DEFAULT_BG;
+  screen.attr = 0;
+}
+
+/**
+ * putGlyph - Store a character at the drawing position
+ * @s: UTF-8 bytes of the character
+ * @len: Length of @s
+ * @width: Display width of the character
+ */
+static void putGlyph(const char *s, int len, int width)
+{
+  if (screen.row < 0 || screen.row >= screen.rows)
+    return;
+
+  // Combining marks join the previous character
+  if (width == 0)
+  {
+    int col = screen.col - 1;
+    if (col >= 0 && backCell(screen.row, col)->len == 0)
+      col--;
+    if (col < 0)
+      return;
+
+    ScreenCell *cell = backCell(screen.row, col);
+    if (cell->len + len <= SCREEN_GLYPH_MAX)
+    {
+      memcpy(&cell->glyph[cell->len], s, len);
+      cell->len += len;
+    }
+    return;
+  }
+
+  if (screen.col >= screen.cols)
+    return;
+
+  // A wide character that doesn't fit leaves a blank
+  if (screen.col + width > screen.cols)
+  {
+    s     = " ";
+    len   = 1;
+    width = 1;
+  }
+
+  ScreenCell *cell = backCell(screen.row, screen.col);
+
+  // Overwriting half of a wide character blanks the other half
+  if (cell->len == 0 && screen.col > 0)
+    setBlank(cell - 1);
+  if (screen.col + width < screen.cols && cell[width].len == 0)
+    setBlank(&cell[width]);
+
+  memcpy(cell->glyph, s, len);
+  cell->len  = len;
+  cell->attr = screen.attr;
+  cell->fg   = screen.fg;
+  cell->bg   = screen.bg;
+
+  if (width == 2)
+  {
+    cell[1].len  = 0;
+    cell[1].attr = screen.attr;
+    cell[1].fg   = screen.fg;
+    cell[1].bg   = screen.bg;
+  }
+
+  screen.col += width;
+}
+
+void screenPutN(const char *s, size_t n)
+{
+  size_t i = 0;
+  while (i < n)
+  {
+    uint8_t c = s[i];
+    if (c < 0x80)
+    {
+      putGlyph(&s[i], 1, 1);
+      i++;
+      continue;
+    }
+
+    UnicodeChar chars[UTF8_SPAN_CHUNK];
+    size_t      count = decodeUTF8Span(&s[i], n - i, chars, UTF8_SPAN_CHUNK);
+    for (size_t j = 0; j < count; j++)
+    {
+      int width = (chars[j].unicode < 0x80) ? 1 : chars[j].width;
+      if (width >= 0 && chars[j].byte_size <= SCREEN_GLYPH_MAX)
+        putGlyph(&s[i], chars[j].byte_size, width);
+      i += chars[j].byte_size;
+    }
+  }
+}
+
+void screenEraseLine(void)
+{
+  if (screen.row < 0 || screen.row >= screen.rows)
+    return;
+
+  uint8_t attr = screen.attr;
+  screen.attr  = 0;
+  for (int col = screen.col; col < screen.cols; col++)
+  {
+    ScreenCell *cell = backCell(screen.row, col);
+    setBlank(cell);
+    cell->attr = 0;
+    cell->fg   = screen.fg;
+    cell->bg   = screen.bg;
+  }
+  screen.attr = attr;
+}
+
+void screenScroll(int top, int bottom, int n)
+{
+  screen.scroll_top    = top - 1;
+  screen.scroll_bottom = bottom - 1;
+  screen.scroll_n      = n;
+}
+
+/**
+ * struct Pen - Colors and attributes the terminal currently draws with
+ */
+typedef struct Pen
+{
+  bool    valid;
+  uint8_t fg;
+  uint8_t bg;
+  uint8_t attr;
+} Pen;
+
+/**
+ * setPen - Switch the terminal to the colors and attributes of a cell
+ * @ab: Buffer for the output
+ * @pen: Current pen, updated
+ * @cell: The cell
+ *
+ * Everything that changes is combined into one SGR sequence made of the
+ * precomputed palette parameters.
+ */
+static void setPen(abuf *ab, Pen *pen, const ScreenCell *cell)
+{
+  bool set_attr = !pen->valid || pen->attr != cell->attr;
+  bool set_fg   = !pen->valid || pen->fg != cell->fg;
+  bool set_bg   = !pen->valid || pen->bg != cell->bg;
+  if (!set_attr && !set_fg && !set_bg)
+    return;
+
+  char buf[64] = "\x1b[";
+  int  len     = 2;
+
+  if (set_attr)
+  {
+    const char *attr = (cell->attr & SCREEN_ATTR_INVERT) ? "7" : "27";
+    memcpy(&buf[len], attr, strlen(attr));
+    len += strlen(attr);
+  }
+
+  if (set_fg)
+  {
+    if (len > 2)
+      buf[len++] = ';';
+    memcpy(&buf[len], sgr_params[0][cell->fg], sgr_params_len[0][cell->fg]);
+    len += sgr_params_len[0][cell->fg];
+  }
+
+  if (set_bg)
+  {
+    if (len > 2)
+      buf[len++] = ';';
+    memcpy(&buf[len], sgr_params[1][cell->bg], sgr_params_len[1][cell->bg]);
+    len += sgr_params_len[1][cell->bg];
+  }
+
+  buf[len++] = 'm';
+  abufAppendN(ab, buf, len);
+
+  pen->valid = true;
+  pen->attr  = cell->attr;
+  pen->fg    = cell->fg;
+  pen->bg    = cell->bg;
+}
+
+/**
+ * isBlankTail - Check if a row only has blank cells from a column
+ * @row: The row
+ * @col: The first column
+ *
+ * Returns: true if the cells can be cleared with one erase
+ */
+static bool isBlankTail(int row, int col)
+{
+  const ScreenCell *first = backCell(row, col);
+  for (int i = col; i < screen.cols; i++)
+  {
+    const ScreenCell *cell = backCell(row, i);
+    if (cell->len != 1 || cell->glyph[0] != ' ' || cell->attr || cell->bg != first->bg)
+      return false;
+  }
+  return true;
+}
+
+/**
+ * scrollFront - Shift the terminal rows of the scroll hint
+ * @ab: Buffer for the output
+ *
+ * Scrolls the hinted rows with a scroll region when more cells of the back
+ * buffer match the shifted front buffer than the unshifted one, then
+ * shifts the front buffer the same way. Rows exposed by the scroll are
+ * marked unknown so the diff redraws them.
+ *
+ * Returns: true if the rows were scrolled
+ */
+static bool scrollFront(abuf *ab)
+{
+  int top    = screen.scroll_top;
+  int bottom = screen.scroll_bottom;
+  int n      = screen.scroll_n;
+  int height = bottom - top + 1;
+
+  screen.scroll_n = 0;
+  if (n == 0 || top < 0 || bottom >= screen.rows || abs(n) >= height)
+    return false;
+
+  size_t kept    = 0;
+  size_t shifted = 0;
+  for (int y = top; y <= bottom; y++)
+  {
+    int src = y + n;
+    for (int x = 0; x < screen.cols; x++)
+    {
+      const ScreenCell *cell = backCell(y, x);
+      if (cellEqual(cell, frontCell(y, x)))
+        kept++;
+      if (src >= top && src <= bottom && cellEqual(cell, frontCell(src, x)))
+        shifted++;
+    }
+  }
+  if (shifted <= kept + SCREEN_SCROLL_MIN)
+    return false;
+
+  // Scroll up (SU) or down (SD) inside the region, then reset the region
+  abufAppendStr(ab, ANSI_CURSOR_HIDE);
+  char buf[64];
+  int  len = snprintf(buf, sizeof(buf), "\x1b[%d;%dr\x1b[%d%c\x1b[r", top + 1, bottom + 1, abs(n),
+                      (n > 0) ? 'S' : 'T');
+  abufAppendN(ab, buf, len);
+
+  size_t row_size = screen.cols * sizeof(ScreenCell);
+  int    exposed;
+  if (n > 0)
+  {
+    memmove(frontCell(top, 0), frontCell(top + n, 0), (height - n) * row_size);
+    exposed = bottom - n + 1;
+  }
+  else
+  {
+    memmove(frontCell(top - n, 0), frontCell(top, 0), (height + n) * row_size);
+    exposed = top;
+  }
+
+  for (int i = 0; i < abs(n) * screen.cols; i++)
+  {
+    frontCell(exposed, 0)[i].len = SCREEN_CELL_UNKNOWN;
+  }
+  return true;
+}
+
+/**
+ * renderFrame - Append the difference between the frames to a buffer
+ * @ab: Buffer for the output
+ * @cursor_row: Row of the cursor, 1-based
+ * @cursor_col: Column of the cursor, 1-based
+ * @show_cursor: Whether the cursor is visible
+ * @full: Set to whether every cell was redrawn
+ *
+ * Returns: Number of changed cells
+ */
+static size_t renderFrame(abuf *ab, int cursor_row, int cursor_col, bool show_cursor, bool *full)
+{
+  Pen pen = {0};
+  *full   = screen.invalid || CONVAR_GETINT(fullredraw);
+
+  // Terminal cursor position, -1 if unknown
+  int    term_row = -1;
+  int    term_col = -1;
+  size_t changed  = 0;
+  bool   hidden   = false;
+
+  if (*full)
+  {
+    screen.scroll_n = 0;
+  }
+  else if (scrollFront(ab))
+  {
+    screen.stats.scrolls++;
+    hidden = true;
+  }
+
+  for (int y = 0; y < screen.rows; y++)
+  {
+    const ScreenCell *front = &screen.front[y * screen.cols];
+    const ScreenCell *back  = &screen.back[y * screen.cols];
+
+    int x = 0;
+    while (x < screen.cols)
+    {
+      if (!*full && cellEqual(&back[x], &front[x]))
+      {
+        x++;
+        continue;
+      }
+
+      // Redraw the left half of a wide character
+      if (back[x].len == 0 && x > 0)
+        x--;
+
+      if (!hidden)
+      {
+        abufAppendStr(ab, ANSI_CURSOR_HIDE);
+        hidden = true;
+      }
+
+      // Clear the rest of the row at once
+      if (screen.cols - x >= SCREEN_ERASE_MIN && isBlankTail(y, x))
+      {
+        if (term_row != y || term_col != x)
+          gotoXY(ab, y + 1, x + 1);
+        setPen(ab, &pen, &back[x]);
+        abufAppendStr(ab, ANSI_ERASE_LINE);
+        changed += screen.cols - x;
+        term_row = y;
+        term_col = x;
+        break;
+      }
+
+      // Rewrite a few unchanged cells rather than moving the cursor
+      if (term_row == y && term_col <= x && x - term_col <= SCREEN_SKIP_MAX)
+        x = term_col;
+      else
+        gotoXY(ab, y + 1, x + 1);
+
+      int width = (x + 1 < screen.cols && back[x + 1].len == 0) ? 2 : 1;
+      setPen(ab, &pen, &back[x]);
+      abufAppendN(ab, back[x].glyph, back[x].len);
+      changed++;
+      x += width;
+
+      term_row = (x < screen.cols) ? y : -1;
+      term_col = x;
+    }
+  }
+
+  bool cursor_moved = (cursor_row != screen.cursor_row || cursor_col != screen.cursor_col ||
+                       show_cursor != screen.cursor_shown);
+  if (hidden || cursor_moved || *full)
+  {
+    if (show_cursor)
+    {
+      gotoXY(ab, cursor_row, cursor_col);
+      abufAppendStr(ab, ANSI_CURSOR_SHOW);
+    }
+    else
+    {
+      abufAppendStr(ab, ANSI_CURSOR_HIDE);
+    }
+
+    if (pen.valid)
+      abufAppendStr(ab, ANSI_CLEAR);
+  }
+
+  screen.cursor_row   = cursor_row;
+  screen.cursor_col   = cursor_col;
+  screen.cursor_shown = show_cursor;
+
+  // The back buffer is redrawn from scratch, so the buffers can swap
+  ScreenCell *temp = screen.front;
+  screen.front     = screen.back;
+  screen.back      = temp;
+  screen.invalid   = false;
+
+  return changed;
+}
+
+void screenFlush(int cursor_row, int cursor_col, bool show_cursor)
+{
+  abuf *ab   = &screen.out;
+  bool  sync = CONVAR_GETINT(syncoutput);
+  bool  full;
+
+  ab->len = 0;
+  if (sync)
+    abufAppendStr(ab, ANSI_SYNC_BEGIN);
+
+  size_t start   = ab->len;
+  size_t changed = renderFrame(ab, cursor_row, cursor_col, show_cursor, &full);
+
+  if (ab->len == start)
+    ab->len = 0;
+  else if (sync)
+    abufAppendStr(ab, ANSI_SYNC_END);
+
+  // The whole frame goes out in one write
+  if (ab->len)
+    writeConsoleAll(ab->buf, ab->len);
+
+  screen.stats.frames++;
+  screen.stats.last_bytes  = ab->len;
+  screen.stats.last_cells  = changed;
+  screen.stats.total_bytes += ab->len;
+  if (full)
+    screen.stats.full_frames++;
+}
+
+#ifdef _DEBUG
+
+void screenRender(abuf *ab, int cursor_row, int cursor_col, bool show_cursor)
+{
+  bool full;
+  renderFrame(ab, cursor_row, cursor_col, show_cursor, &full);
+}
+
+#endif
+
+void screenInvalidate(void)
+{
+  screen.invalid = true;
+}
+
+const ScreenStats *screenGetStats(void)
+{
+  return &screen.stats;
+}
+
+void screenFree(void)
+{
+  free(screen.front);
+  free(screen.back);
+  abufFree(&screen.out);
+  screen.front = NULL;
+  screen.back  = NULL;
+  screen.rows  = 0;
+  screen.cols  = 0;
+}
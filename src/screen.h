@@ -0,0 +1,164 @@
+#ifndef SCREEN_H
+#define SCREEN_H
+
+#include "utils.h"
+
+/**
+ * Cell attribute flags
+ */
+#define SCREEN_ATTR_INVERT (1 << 0)  // Swap foreground and background
+
+// Longest glyph stored in a cell, a character and its combining marks
+#define SCREEN_GLYPH_MAX 7
+
+// Palette indices of the terminal default colors, after the color scheme
+#define SCREEN_DEFAULT_FG 0xFE
+#define SCREEN_DEFAULT_BG 0xFF
+
+/**
+ * struct ScreenCell - One character cell of the terminal
+ * @glyph: UTF-8 bytes of the character
+ * @len: Length of @glyph, 0 for the right half of a wide character
+ * @attr: SCREEN_ATTR_* flags
+ * @fg: Palette index of the foreground color
+ * @bg: Palette index of the background color
+ *
+ * The palette is the editor color scheme, see screenLoadPalette().
+ */
+typedef struct ScreenCell
+{
+  char    glyph[SCREEN_GLYPH_MAX];
+  uint8_t len;
+  uint8_t attr;
+  uint8_t fg;
+  uint8_t bg;
+} ScreenCell;
+
+/**
+ * struct ScreenStats - Output statistics of the renderer
+ * @frames: Number of flushed frames
+ * @last_bytes: Bytes written by the last frame
+ * @last_cells: Cells changed by the last frame
+ * @total_bytes: Bytes written by all frames
+ * @full_frames: Frames that redrew the whole screen
+ * @scrolls: Frames that scrolled rows with a scroll region
+ */
+typedef struct ScreenStats
+{
+  size_t frames;
+  size_t last_bytes;
+  size_t last_cells;
+  size_t total_bytes;
+  size_t full_frames;
+  size_t scrolls;
+} ScreenStats;
+
+/**
+ * screenBeginFrame - Start drawing a new frame
+ *
+ * Resizes the buffers to the editor screen size and clears the back
+ * buffer. Drawing functions write into the back buffer only.
+ */
+void screenBeginFrame(void);
+
+/**
+ * screenMoveTo - Move the drawing position
+ * @row: Row, 1-based
+ * @col: Column, 1-based, 0 is the same as 1
+ */
+void screenMoveTo(int row, int col);
+
+/**
+ * screenLoadPalette - Precompute the escape sequences of the color scheme
+ *
+ * Maps each color to the nearest one of the colormode palette. Must be
+ * called after gEditor.color_cfg or colormode changes. Redraws every cell
+ * on the next flush since cells only store palette indices.
+ */
+void screenLoadPalette(void);
+
+/**
+ * screenSetColor - Set the drawing color
+ * @color: An entry of gEditor.color_cfg
+ * @is_bg: Set the background instead of the foreground
+ */
+void screenSetColor(const Color *color, int is_bg);
+
+/**
+ * screenSetAttr - Set the cell attributes used for drawing
+ * @attr: SCREEN_ATTR_* flags
+ */
+void screenSetAttr(uint8_t attr);
+
+/**
+ * screenResetColor - Reset the colors and attributes to the terminal default
+ */
+void screenResetColor(void);
+
+/**
+ * screenPutN - Draw UTF-8 text at the drawing position
+ * @s: The text
+ * @n: Length of the text in bytes
+ *
+ * Text past the right edge of the screen is dropped.
+ */
+void screenPutN(const char *s, size_t n);
+#define screenPutStr(s) screenPutN((s), sizeof(s) - 1)
+
+/**
+ * screenEraseLine - Clear the rest of the row with the background color
+ */
+void screenEraseLine(void);
+
+/**
+ * screenScroll - Hint that rows of the new frame moved
+ * @top: First row of the region, 1-based
+ * @bottom: Last row of the region, 1-based
+ * @n: Rows the content moved up, negative for down
+ *
+ * The next flush shifts the rows on the terminal with a scroll region
+ * when that saves output, and only redraws the rows that don't match.
+ */
+void screenScroll(int top, int bottom, int n);
+
+/**
+ * screenFlush - Write the difference between the frames to the terminal
+ * @cursor_row: Row of the cursor, 1-based
+ * @cursor_col: Column of the cursor, 1-based
+ * @show_cursor: Whether the cursor is visible
+ *
+ * Emits only the cells that changed since the previous frame, then the
+ * back buffer becomes the front buffer. The frame is written with one
+ * write, inside a synchronized update if syncoutput is set.
+ */
+void screenFlush(int cursor_row, int cursor_col, bool show_cursor);
+
+#ifdef _DEBUG
+/**
+ * screenRender - Append the difference between the frames to a buffer
+ *
+ * Same as screenFlush without writing to the terminal, for benchmarks.
+ */
+void screenRender(abuf *ab, int cursor_row, int cursor_col, bool show_cursor);
+#endif
+
+/**
+ * screenInvalidate - Redraw every cell on the next flush
+ *
+ * Used when the terminal content is unknown, e.g. after a resize.
+ */
+void screenInvalidate(void);
+
+/**
+ * screenGetStats - Get the output statistics
+ *
+ * Returns: Pointer to the statistics
+ */
+const ScreenStats *screenGetStats(void);
+
+/**
+ * screenFree - Free the screen buffers
+ */
+void screenFree(void);
+
+#endif
@@ -70,6 +70,7 @@ void editorDeleteText(EditorSelectRange range)
 
     gCurFile->num_rows -= removed_rows;
     gCurFile->cursor.y -= removed_rows;
+    editorWrapDeleteRows(gCurFile, range.start_y + 1, removed_rows);
 
     gCurFile->lilex_width = getDigit(gCurFile->num_rows) + 2;
   }
@@ -81,6 +82,7 @@ void editorDeleteText(EditorSelectRange range)
 
 void editorCopyText(EditorClipboard *clipboard, EditorSelectRange range)
 {
+  clipboard->buf = NULL;
   if (range.start_x == range.end_x && range.start_y == range.end_y)
   {
     clipboard->size  = 0;
@@ -127,6 +129,7 @@ void editorCopyText(EditorClipboard *clipboard, EditorSelectRange range)
 
 void editorCopyLine(EditorClipboard *clipboard, int row)
 {
+  clipboard->buf = NULL;
   if (row < 0 || row >= gCurFile->num_rows)
   {
     clipboard->size  = 0;
@@ -175,10 +178,7 @@ void editorPasteText(const EditorClipboard *clipboard, int x, int y)
     editorRowAppendString(gCurFile, &gCurFile->row[y], clipboard->lines[0].data,
                           clipboard->lines[0].size);
     // Middle
-    for (size_t i = 1; i < clipboard->size - 1; i++)
-    {
-      editorInsertRow(gCurFile, y + i, clipboard->lines[i].data, clipboard->lines[i].size);
-    }
+    editorInsertRows(gCurFile, y + 1, &clipboard->lines[1], clipboard->size - 2);
     // Last line
     EditorRow *row       = &gCurFile->row[y + clipboard->size - 1];
     char      *paste     = clipboard->lines[clipboard->size - 1].data;
@@ -195,9 +195,17 @@ void editorFreeClipboardContent(EditorClipboard *clipboard)
 {
   if (!clipboard || !clipboard->size)
     return;
-  for (size_t i = 0; i < clipboard->size; i++)
+  if (clipboard->buf)
+  {
+    free(clipboard->buf);
+    clipboard->buf = NULL;
+  }
+  else
   {
-    free(clipboard->lines[i].data);
+    for (size_t i = 0; i < clipboard->size; i++)
+    {
+      free(clipboard->lines[i].data);
+    }
   }
   clipboard->size = 0;
   free(clipboard->lines);
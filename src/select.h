@@ -3,10 +3,17 @@
 
 #include "utils.h"
 
+/**
+ * struct EditorClipboard - Lines of copied text
+ * @size: Number of lines
+ * @lines: The lines, without newlines
+ * @buf: Storage of all the lines, or NULL when each line has its own
+ */
 typedef struct EditorClipboard
 {
   size_t size;
   Str   *lines;
+  char  *buf;
 } EditorClipboard;
 
 typedef struct EditorSelectRange
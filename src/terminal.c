@@ -125,7 +125,194 @@ static bool parseMouseSGR(const char *seq, int *Cb, int *Cx, int *Cy, char *fin)
   return true;
 }
 
-EditorInput editorReadKey(void)
+/**
+ * cleanPaste - Prepare pasted text to be split into lines
+ * @buf: The text
+ * @len: Length of the text
+ *
+ * Turns CRLF and CR into LF and drops invalid UTF-8, in place. ASCII
+ * without CR is skipped eight bytes at a time.
+ *
+ * Returns: The new length
+ */
+static size_t cleanPaste(char *buf, size_t len)
+{
+  const uint64_t ones  = 0x0101010101010101ULL;
+  const uint64_t highs = 0x8080808080808080ULL;
+  const uint64_t crs   = ones * '\r';
+
+  size_t in  = 0;
+  size_t out = 0;
+  while (in < len)
+  {
+    for (; in + 8 <= len; in += 8, out += 8)
+    {
+      uint64_t w;
+      memcpy(&w, &buf[in], 8);
+      uint64_t t = w ^ crs;
+      if ((w | ((t - ones) & ~t)) & highs)
+        break;
+      if (out != in)
+        memcpy(&buf[out], &w, 8);
+    }
+    if (in == len)
+      break;
+
+    uint8_t c = buf[in];
+    if (c == '\r')
+    {
+      buf[out++] = '\n';
+      in += (in + 1 < len && buf[in + 1] == '\n') ? 2 : 1;
+      continue;
+    }
+    if (c < 0x80)
+    {
+      buf[out++] = c;
+      in++;
+      continue;
+    }
+
+    // Keep a whole character, or drop its first byte and go on after it
+    uint32_t state = UTF8_ACCEPT;
+    uint32_t code;
+    size_t   end = in;
+    while (end < len && decodeUTF8Byte(&state, &code, buf[end++]) != UTF8_ACCEPT &&
+           state != UTF8_REJECT)
+    {
+    }
+    if (state != UTF8_ACCEPT)
+    {
+      in++;
+      continue;
+    }
+    memmove(&buf[out], &buf[in], end - in);
+    out += end - in;
+    in = end;
+  }
+  return out;
+}
+
+// Longest pause in the text of a paste, a terminal or ssh link may stall
+#define PASTE_TIMEOUT 5000
+
+/**
+ * readPaste - Read the text of a bracketed paste
+ *
+ * The text is read in chunks straight into one buffer, then cleaned and
+ * split into lines in place. The lines of the clipboard point into the
+ * buffer, which the clipboard owns. When the end marker doesn't come in
+ * PASTE_TIMEOUT, the text read so far is the paste.
+ */
+static EditorInput readPaste(void)
+{
+  static const char end[] = "[201~";
+
+  EditorInput result = {.type = UNKNOWN};
+  char       *buf    = NULL;
+  size_t      len    = 0;
+  size_t      cap    = 0;
+  bool        done   = false;
+
+  while (!done)
+  {
+    if (cap - len < 4096)
+    {
+      cap = cap ? cap * 2 : 65536;
+      buf = realloc_s(buf, cap);
+    }
+
+    size_t n = readConsoleText(&buf[len], cap - len, PASTE_TIMEOUT);
+    if (n == 0)
+      break;
+    len += n;
+
+    // Only the end marker finishes the text, other escapes are pasted
+    while (buf[len - 1] == ESC)
+    {
+      uint32_t c;
+      size_t   matched = 0;
+      bool     stalled = false;
+      while (matched < sizeof(end) - 1)
+      {
+        if (!readConsole(&c, PASTE_TIMEOUT))
+        {
+          stalled = true;
+          break;
+        }
+        if (c != (uint32_t) end[matched])
+          break;
+        matched++;
+      }
+
+      if (matched == sizeof(end) - 1)
+      {
+        len--;
+        done = true;
+        break;
+      }
+
+      if (cap - len < sizeof(end) + 4)
+      {
+        cap *= 2;
+        buf = realloc_s(buf, cap);
+      }
+      memcpy(&buf[len], end, matched);
+      len += matched;
+      if (stalled)
+      {
+        done = true;
+        break;
+      }
+      int bytes = encodeUTF8(c, &buf[len]);
+      if (bytes > 0)
+        len += bytes;
+    }
+  }
+
+  len = cleanPaste(buf, len);
+  if (len == 0)
+  {
+    free(buf);
+    result.type       = PASTE_INPUT;
+    result.data.paste = (EditorClipboard){0};
+    return result;
+  }
+
+  // Give back the room for more text
+  buf = realloc_s(buf, len);
+
+  size_t count = 1;
+  for (const char *p = buf; (p = memchr(p, '\n', buf + len - p)); p++)
+  {
+    count++;
+  }
+
+  EditorClipboard clipboard = {
+      .size  = count,
+      .lines = malloc_s(sizeof(Str) * count),
+      .buf   = buf,
+  };
+  char *line = buf;
+  for (size_t i = 0; i < count - 1; i++)
+  {
+    char *nl                = memchr(line, '\n', buf + len - line);
+    clipboard.lines[i].data = line;
+    clipboard.lines[i].size = nl - line;
+    line                    = nl + 1;
+  }
+  clipboard.lines[count - 1].data = line;
+  clipboard.lines[count - 1].size = buf + len - line;
+
+  result.type       = PASTE_INPUT;
+  result.data.paste = clipboard;
+  return result;
+}
+
+// Input read ahead while coalescing mouse moves
+static EditorInput unread_input;
+static bool        has_unread_input = false;
+
+static EditorInput readKey(void)
 {
   static bool scroll_pressed = false;
 
@@ -176,99 +363,7 @@ EditorInput editorReadKey(void)
 
     // Bracketed paste
     if (strcmp(seq, "[200~") == 0)
-    {
-      VECTOR(Str) content = {0};
-      abuf line           = ABUF_INIT;
-
-      bool last_was_cr = false;
-      while (true)
-      {
-        if (!readConsole(&c, timeout))
-        {
-          free(content.data);
-          abufFree(&line);
-          return result;
-        }
-
-        if (c == ESC)
-        {
-          uint32_t   end_seq[5];
-          bool       is_end      = true;
-          const char expected[5] = {'[', '2', '0', '1', '~'};
-
-          size_t index;
-          for (index = 0; index < sizeof(end_seq) / sizeof(end_seq[0]); index++)
-          {
-            if (!readConsole(&end_seq[index], timeout))
-            {
-              free(content.data);
-              abufFree(&line);
-              return result;
-            }
-
-            if (end_seq[index] != (uint32_t) expected[index])
-            {
-              is_end = false;
-              break;
-            }
-          }
-
-          if (is_end)
-          {
-            EditorClipboard clipboard = {0};
-            if (content.size || line.len)
-            {
-              Str s_line = {
-                  .data = line.buf,
-                  .size = line.len,
-              };
-              vector_push(content, s_line);
-              vector_shrink(content);
-
-              clipboard.size  = content.size;
-              clipboard.lines = content.data;
-            }
-
-            result.type       = PASTE_INPUT;
-            result.data.paste = clipboard;
-            return result;
-          }
-
-          // paste the escape sequence so far in
-          abufAppendN(&line, expected, index);
-          // let the rest of the logic handle the last input
-          c = end_seq[index];
-        }
-
-        if (c == '\r' || c == '\n')
-        {
-          if (c == '\n' && last_was_cr)
-          {
-            last_was_cr = false;
-            continue;
-          }
-
-          last_was_cr = (c == '\r');
-
-          Str s_line = {
-              .data = line.buf,
-              .size = line.len,
-          };
-          vector_push(content, s_line);
-          memset(&line, 0, sizeof(abuf));
-        }
-        else
-        {
-          last_was_cr = false;
-
-          char utf8[4];
-          int  bytes = encodeUTF8(c, utf8);
-          if (bytes == -1)
-            continue;
-          abufAppendN(&line, utf8, bytes);
-        }
-      }
-    }
+      return readPaste();
 
     // Mouse input
     if (seq[1] == '<')
@@ -372,6 +467,36 @@ EditorInput editorReadKey(void)
   return result;
 }
 
+EditorInput editorReadKey(void)
+{
+  if (has_unread_input)
+  {
+    has_unread_input = false;
+    return unread_input;
+  }
+
+  EditorInput input = readKey();
+
+  // Only the last of consecutive mouse moves matters
+  while (input.type == MOUSE_MOVE && pollConsole(0))
+  {
+    EditorInput next = readKey();
+    if (next.type != MOUSE_MOVE)
+    {
+      unread_input     = next;
+      has_unread_input = true;
+      break;
+    }
+    input = next;
+  }
+  return input;
+}
+
+bool editorInputPending(int timeout_ms)
+{
+  return has_unread_input || pollConsole(timeout_ms);
+}
+
 void editorFreeInput(EditorInput *input)
 {
   if (!input)
@@ -17,6 +17,10 @@
 #define ANSI_CURSOR_SHOW "\x1b[?25h"
 #define ANSI_CURSOR_HIDE "\x1b[?25l"
 
+// Synchronized update, the terminal shows the frame once it ends
+#define ANSI_SYNC_BEGIN "\x1b[?2026h"
+#define ANSI_SYNC_END "\x1b[?2026l"
+
 // Keys
 #define CTRL_KEY(k) ((k) & 0x1F)
 #define ALT_KEY(k) ((k) | 0x1B00)
@@ -89,6 +93,7 @@ typedef struct EditorInput
 
 void        editorInitTerminal(void);
 EditorInput editorReadKey(void);
+bool        editorInputPending(int timeout_ms);
 void        editorFreeInput(EditorInput *input);
 
 void enableMouse(void);
@@ -1,8 +1,30 @@
 #ifndef UNICODE_H
 #define UNICODE_H
 
+// States of the UTF-8 decoder
+#define UTF8_ACCEPT 0
+#define UTF8_REJECT 12
+
+// Characters decoded per call when walking a long string with decodeUTF8Span()
+#define UTF8_SPAN_CHUNK 64
+
+/**
+ * struct UnicodeChar - A decoded character
+ * @unicode: Code point, U+FFFD for an invalid sequence
+ * @byte_size: Bytes of the encoded character
+ * @width: Display width, see unicodeWidth()
+ */
+typedef struct UnicodeChar
+{
+  uint32_t unicode;
+  uint8_t  byte_size;
+  int8_t   width;
+} UnicodeChar;
+
 int      encodeUTF8(unsigned int code_point, char output[4]);
 uint32_t decodeUTF8(const char *str, size_t len, size_t *byte_size);
+uint32_t decodeUTF8Byte(uint32_t *state, uint32_t *code, uint8_t byte);
+size_t   decodeUTF8Span(const char *str, size_t len, UnicodeChar *out, size_t max);
 int      unicodeWidth(uint32_t ucs);
 int      strUTF8Width(const char *str);
 
@@ -174,30 +174,6 @@ bool strToColor(const char *color, Color *out)
   return true;
 }
 
-/**
- * Menambahkan escape sequence warna ANSI ke buffer
- * @param ab: append buffer
- * @param color: struktur warna RGB
- * @param is_bg: 1 untuk background, 0 untuk foreground
- */
-void setColor(abuf *ab, Color color, int is_bg)
-{
-  char buf[32];
-  int  len;
-  // Warna hitam (0,0,0) pada background diubah ke default background
-  if (color.r == 0 && color.g == 0 && color.b == 0 && is_bg)
-  {
-    len = snprintf(buf, sizeof(buf), "%s", ANSI_DEFAULT_BG);
-  }
-  else
-  {
-    // Format ANSI: ESC[38;2;R;G;Bm untuk foreground, ESC[48;2;R;G;Bm untuk background
-    len = snprintf(buf, sizeof(buf), "\x1b[%d;2;%d;%d;%dm", is_bg ? 48 : 38, color.r, color.g,
-                   color.b);
-  }
-  abufAppendN(ab, buf, len);
-}
-
 /**
  * Pindahkan kursor ke posisi (x, y) menggunakan ANSI escape sequence
  * @param ab: append buffer
@@ -84,7 +84,6 @@ typedef struct Color
 
 bool strToColor(const char *color, Color *out);
 int  colorToStr(Color color, char buf[8]);
-void setColor(abuf *ab, Color color, int is_bg);
 
 // Separator
 typedef int (*IsCharFunc)(int c);
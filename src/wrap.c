@@ -0,0 +1,396 @@
+#include "wrap.h"
+
+#include <limits.h>
+
+#include "editor.h"
+#include "row.h"
+#include "unicode.h"
+
+/**
+ * textCols - Get the width of the text area of a file
+ * @file: The file
+ */
+static int textCols(const EditorFile *file)
+{
+  int cols = gEditor.screen_cols - gEditor.explorer.width -
+             (CONVAR_GETINT(lilex) ? file->lilex_width : 0);
+  return (cols < 1) ? 1 : cols;
+}
+
+/**
+ * struct WrapWalk - Position of a walk over the screen lines of a row
+ * @cx: Character the walk continues from
+ * @rx: Rendered column of @cx
+ */
+typedef struct WrapWalk
+{
+  int cx;
+  int rx;
+} WrapWalk;
+
+/**
+ * rowWrapEnd - Find where a screen line of a row ends
+ * @row: The row
+ * @cols: Width of the screen lines
+ * @start: First rendered column of the screen line
+ * @walk: Character at or before @start, set to where the next line starts
+ * @more: Set to whether another screen line follows
+ *
+ * A screen line breaks when it is full, or before a wide character that
+ * doesn't fit. A tab may continue on the next screen line. The end of the
+ * row starts a new screen line when the last one is full, so the cursor
+ * always has a place to go.
+ *
+ * Returns: Rendered column after the end of the screen line
+ */
+static int rowWrapEnd(const EditorRow *row, int cols, int start, WrapWalk *walk, bool *more)
+{
+  int rsize = editorRowCxToRx(row, row->size);
+
+  // ASCII rows break at every multiple of cols
+  if (row->flags & ROW_ASCII)
+  {
+    *more = (start + cols <= rsize);
+    return *more ? start + cols : rsize;
+  }
+
+  int tabsize = CONVAR_GETINT(tabsize);
+  int cx      = walk->cx;
+  int rx      = walk->rx;
+  int col     = rx - start;
+
+  *more = true;
+  UnicodeChar chars[UTF8_SPAN_CHUNK];
+  while (cx < row->size)
+  {
+    size_t decoded = decodeUTF8Span(&row->data[cx], row->size - cx, chars, UTF8_SPAN_CHUNK);
+    for (size_t i = 0; i < decoded; i++)
+    {
+      int width;
+      if (chars[i].unicode == '\t')
+      {
+        width = tabsize - (rx % tabsize);
+      }
+      else
+      {
+        width = (chars[i].width < 0) ? 1 : chars[i].width;
+        if (width > 1 && col > 0 && col + width > cols)
+        {
+          walk->cx = cx;
+          walk->rx = rx;
+          return rx;
+        }
+      }
+
+      // A tab that doesn't fit continues on the next line
+      if (col + width > cols)
+      {
+        walk->cx = cx;
+        walk->rx = rx;
+        return rx + (cols - col);
+      }
+
+      rx += width;
+      col += width;
+      cx += chars[i].byte_size;
+      if (col == cols)
+      {
+        walk->cx = cx;
+        walk->rx = rx;
+        return rx;
+      }
+    }
+  }
+
+  *more = false;
+  return rsize;
+}
+
+/**
+ * rowWrapFind - Find a screen line of a row
+ * @row: The row
+ * @cols: Width of the screen lines
+ * @want: Screen line to find, or -1 to find the one showing @want_rx
+ * @want_rx: Rendered column to find
+ * @span: Set to the first column and the column after the end of the line
+ *
+ * Returns: The screen line, the last one if the row has fewer
+ */
+static int rowWrapFind(const EditorRow *row, int cols, int want, int want_rx, int span[2])
+{
+  bool more;
+
+  // ASCII rows have a screen line every cols columns
+  if (row->flags & ROW_ASCII)
+  {
+    int last = editorRowCxToRx(row, row->size) / cols;
+    int line = (want >= 0) ? want : want_rx / cols;
+    line     = (line < 0) ? 0 : (line > last) ? last : line;
+    span[0]  = line * cols;
+    span[1]  = rowWrapEnd(row, cols, span[0], NULL, &more);
+    return line;
+  }
+
+  WrapWalk walk = {0, 0};
+  int      line = 0;
+  span[0]       = 0;
+  span[1]       = rowWrapEnd(row, cols, 0, &walk, &more);
+  while (more && ((want >= 0) ? line < want : span[1] <= want_rx))
+  {
+    span[0] = span[1];
+    span[1] = rowWrapEnd(row, cols, span[0], &walk, &more);
+    line++;
+  }
+  return line;
+}
+
+static inline int rowWrapLines(const EditorRow *row, int cols)
+{
+  int span[2];
+  return rowWrapFind(row, cols, INT_MAX, 0, span) + 1;
+}
+
+static void wrapBuildTree(WrapIndex *wrap)
+{
+  for (int i = 1; i <= wrap->count; i++)
+  {
+    wrap->tree[i] = wrap->lines[i - 1];
+  }
+  for (int i = 1; i <= wrap->count; i++)
+  {
+    int parent = i + (i & -i);
+    if (parent <= wrap->count)
+      wrap->tree[parent] += wrap->tree[i];
+  }
+  wrap->dirty = false;
+}
+
+static void wrapEnsureCapacity(WrapIndex *wrap, int count)
+{
+  if (wrap->capacity >= count)
+    return;
+
+  int capacity = wrap->capacity ? wrap->capacity : 64;
+  while (capacity < count)
+  {
+    capacity += capacity / 2;
+  }
+  wrap->lines    = realloc_s(wrap->lines, sizeof(int) * capacity);
+  wrap->tree     = realloc_s(wrap->tree, sizeof(int) * (capacity + 1));
+  wrap->capacity = capacity;
+}
+
+/**
+ * wrapMeasure - Measure the row that changed since the index was used
+ * @file: The file
+ */
+static void wrapMeasure(EditorFile *file)
+{
+  WrapIndex *wrap = &file->wrap;
+  if (!wrap->pending)
+    return;
+
+  int at        = wrap->pending - 1;
+  int lines     = rowWrapLines(&file->row[at], wrap->cols);
+  int delta     = lines - wrap->lines[at];
+  wrap->pending = 0;
+  if (delta == 0)
+    return;
+
+  wrap->lines[at] = lines;
+  if (wrap->dirty)
+    return;
+  for (int i = at + 1; i <= wrap->count; i += i & -i)
+  {
+    wrap->tree[i] += delta;
+  }
+}
+
+bool editorWrapReady(EditorFile *file)
+{
+  if (!CONVAR_GETINT(wrap) || file->num_rows == 0)
+    return false;
+
+  WrapIndex *wrap    = &file->wrap;
+  int        cols    = textCols(file);
+  int        tabsize = CONVAR_GETINT(tabsize);
+  if (wrap->cols != cols || wrap->tabsize != tabsize)
+  {
+    wrapEnsureCapacity(wrap, file->num_rows);
+    for (int i = 0; i < file->num_rows; i++)
+    {
+      wrap->lines[i] = rowWrapLines(&file->row[i], cols);
+    }
+    wrap->count   = file->num_rows;
+    wrap->cols    = cols;
+    wrap->tabsize = tabsize;
+    wrap->pending = 0;
+    wrap->dirty   = true;
+  }
+
+  wrapMeasure(file);
+  if (wrap->dirty)
+    wrapBuildTree(wrap);
+  return true;
+}
+
+int editorWrapLineOf(const EditorFile *file, int at)
+{
+  const WrapIndex *wrap = &file->wrap;
+
+  int line = 0;
+  for (int i = (at < wrap->count) ? at : wrap->count; i > 0; i -= i & -i)
+  {
+    line += wrap->tree[i];
+  }
+  return line;
+}
+
+int editorWrapRowAt(const EditorFile *file, int line, int *sub)
+{
+  const WrapIndex *wrap = &file->wrap;
+  if (line < 0)
+  {
+    *sub = 0;
+    return 0;
+  }
+
+  // Descend the tree for the last row that starts at or before line
+  int at   = 0;
+  int step = 1;
+  while (step * 2 <= wrap->count)
+  {
+    step *= 2;
+  }
+  for (; step > 0; step /= 2)
+  {
+    if (at + step <= wrap->count && wrap->tree[at + step] <= line)
+    {
+      at += step;
+      line -= wrap->tree[at];
+    }
+  }
+
+  if (at >= wrap->count)
+  {
+    at   = wrap->count - 1;
+    line = wrap->lines[at] - 1;
+  }
+  *sub = line;
+  return at;
+}
+
+int editorWrapTotal(const EditorFile *file)
+{
+  return editorWrapLineOf(file, file->wrap.count);
+}
+
+int editorWrapLineOfRx(const EditorFile *file, int at, int rx)
+{
+  int span[2];
+  return editorWrapLineOf(file, at) + rowWrapFind(&file->row[at], file->wrap.cols, -1, rx, span);
+}
+
+int editorWrapTop(const EditorFile *file)
+{
+  const WrapIndex *wrap = &file->wrap;
+
+  int at  = (file->row_offset < wrap->count) ? file->row_offset : wrap->count - 1;
+  int sub = file->wrap_offset;
+  if (sub >= wrap->lines[at])
+    sub = wrap->lines[at] - 1;
+  return editorWrapLineOf(file, at) + sub;
+}
+
+void editorWrapSetTop(EditorFile *file, int line)
+{
+  int total = editorWrapTotal(file);
+  if (line >= total)
+    line = total - 1;
+  if (line < 0)
+    line = 0;
+  file->row_offset = editorWrapRowAt(file, line, &file->wrap_offset);
+  file->col_offset = 0;
+}
+
+int editorWrapFindRx(const EditorFile *file, int at, int rx, int *start, int *end)
+{
+  int span[2];
+  int line = rowWrapFind(&file->row[at], file->wrap.cols, -1, rx, span);
+  *start   = span[0];
+  *end     = span[1];
+  return line;
+}
+
+void editorWrapSpan(const EditorFile *file, int at, int sub, int *start, int *end)
+{
+  int span[2];
+  rowWrapFind(&file->row[at], file->wrap.cols, sub, 0, span);
+  *start = span[0];
+  *end   = span[1];
+}
+
+int editorWrapEnd(const EditorFile *file, int at, int start)
+{
+  const EditorRow *row = &file->row[at];
+
+  // Walk from the character at start, a tab may begin on the line before
+  bool     more;
+  WrapWalk walk;
+  walk.cx = editorRowRxToCx(row, start);
+  walk.rx = editorRowCxToRx(row, walk.cx);
+  return rowWrapEnd(row, file->wrap.cols, start, &walk, &more);
+}
+
+void editorWrapUpdateRow(EditorFile *file, int at)
+{
+  WrapIndex *wrap = &file->wrap;
+  if (!wrap->cols || at < 0 || at >= wrap->count)
+    return;
+
+  // Edits usually hit the same row many times between two frames
+  if (wrap->pending != at + 1)
+    wrapMeasure(file);
+  wrap->pending = at + 1;
+}
+
+void editorWrapInsertRows(EditorFile *file, int at, int count)
+{
+  WrapIndex *wrap = &file->wrap;
+  if (!wrap->cols || at < 0 || count <= 0 || at > wrap->count)
+    return;
+
+  wrapEnsureCapacity(wrap, wrap->count + count);
+  memmove(&wrap->lines[at + count], &wrap->lines[at], sizeof(int) * (wrap->count - at));
+  for (int i = at; i < at + count; i++)
+  {
+    wrap->lines[i] = 1;
+  }
+  wrap->count += count;
+  wrap->dirty = true;
+  if (wrap->pending > at)
+    wrap->pending += count;
+}
+
+void editorWrapDeleteRows(EditorFile *file, int at, int count)
+{
+  WrapIndex *wrap = &file->wrap;
+  if (!wrap->cols || at < 0 || count <= 0 || at + count > wrap->count)
+    return;
+
+  memmove(&wrap->lines[at], &wrap->lines[at + count],
+          sizeof(int) * (wrap->count - at - count));
+  wrap->count -= count;
+  wrap->dirty = true;
+  if (wrap->pending > at + count)
+    wrap->pending -= count;
+  else if (wrap->pending > at)
+    wrap->pending = 0;
+}
+
+void editorWrapFree(EditorFile *file)
+{
+  free(file->wrap.lines);
+  free(file->wrap.tree);
+  memset(&file->wrap, 0, sizeof(WrapIndex));
+}
@@ -0,0 +1,142 @@
+#ifndef WRAP_H
+#define WRAP_H
+
+struct EditorFile;
+typedef struct EditorFile EditorFile;
+
+/**
+ * struct WrapIndex - Screen lines of the rows of a file in wrap mode
+ * @lines: Screen lines of each row
+ * @tree: Fenwick tree of @lines, 1-based, for prefix sums
+ * @count: Number of rows in the index
+ * @capacity: Allocated entries of @lines and @tree
+ * @cols: Text width the index was built for, 0 if there is no index
+ * @tabsize: Tab size the index was built for
+ * @dirty: @tree is stale after rows were inserted or deleted
+ * @pending: Row changed since it was last measured plus one, 0 if none
+ *
+ * Built when the file is first drawn in wrap mode, and again only when the
+ * text width or tab size changes. A changed row is measured again the next
+ * time the index is used and updates the tree in O(log n). Inserted and
+ * deleted rows shift @lines, and the tree is rebuilt from it in O(n).
+ */
+typedef struct WrapIndex
+{
+  int *lines;
+  int *tree;
+  int  count;
+  int  capacity;
+  int  cols;
+  int  tabsize;
+  bool dirty;
+  int  pending;
+} WrapIndex;
+
+/**
+ * editorWrapReady - Bring the wrap index of a file up to date
+ * @file: The file
+ *
+ * Returns: Whether wrap mode is on. The other editorWrap* lookups are only
+ * valid after this returned true.
+ */
+bool editorWrapReady(EditorFile *file);
+
+/**
+ * editorWrapLineOf - Get the first screen line of a row
+ * @file: The file
+ * @at: Row index
+ *
+ * Returns: Screen lines of all rows before @at
+ */
+int editorWrapLineOf(const EditorFile *file, int at);
+
+/**
+ * editorWrapRowAt - Find the row shown on a screen line
+ * @file: The file
+ * @line: Screen line from the top of the file
+ * @sub: Set to the screen line within the row
+ *
+ * Returns: Row index, clamped to the rows of the file
+ */
+int editorWrapRowAt(const EditorFile *file, int line, int *sub);
+
+/**
+ * editorWrapTotal - Get the screen lines of the whole file
+ * @file: The file
+ *
+ * Returns: Sum of the screen lines of all rows
+ */
+int editorWrapTotal(const EditorFile *file);
+
+/**
+ * editorWrapLineOfRx - Get the screen line that shows a position
+ * @file: The file
+ * @at: Row index
+ * @rx: Rendered column
+ *
+ * Returns: Screen line from the top of the file
+ */
+int editorWrapLineOfRx(const EditorFile *file, int at, int rx);
+
+/**
+ * editorWrapTop - Get the screen line at the top of the view
+ * @file: The file
+ *
+ * The view starts at screen line wrap_offset of row row_offset.
+ *
+ * Returns: Screen line from the top of the file
+ */
+int editorWrapTop(const EditorFile *file);
+
+/**
+ * editorWrapSetTop - Scroll the view to a screen line
+ * @file: The file
+ * @line: Screen line from the top of the file, clamped to the file
+ */
+void editorWrapSetTop(EditorFile *file, int line);
+
+/**
+ * editorWrapFindRx - Find the screen line of a row that shows a column
+ * @file: The file
+ * @at: Row index
+ * @rx: Rendered column
+ * @start: Set to the first rendered column of the screen line
+ * @end: Set to the rendered column after the end of the screen line
+ *
+ * Returns: Screen line within the row
+ */
+int editorWrapFindRx(const EditorFile *file, int at, int rx, int *start, int *end);
+
+/**
+ * editorWrapSpan - Get the rendered columns shown on a screen line of a row
+ * @file: The file
+ * @at: Row index
+ * @sub: Screen line within the row
+ * @start: Set to the first rendered column of the screen line
+ * @end: Set to the rendered column after the end of the screen line
+ */
+void editorWrapSpan(const EditorFile *file, int at, int sub, int *start, int *end);
+
+/**
+ * editorWrapEnd - Get the end of a screen line of a row
+ * @file: The file
+ * @at: Row index
+ * @start: First rendered column of the screen line
+ *
+ * Returns: Rendered column after the end of the screen line, where the
+ * next screen line starts
+ */
+int editorWrapEnd(const EditorFile *file, int at, int start);
+
+// Keep the index in sync with the rows, no-ops without an index
+void editorWrapUpdateRow(EditorFile *file, int at);
+void editorWrapInsertRows(EditorFile *file, int at, int count);
+void editorWrapDeleteRows(EditorFile *file, int at, int count);
+
+/**
+ * editorWrapFree - Free the wrap index of a file
+ * @file: The file
+ */
+void editorWrapFree(EditorFile *file);
+
+#endif
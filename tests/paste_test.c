@@ -0,0 +1,185 @@
+// Runs the editor in a pseudo terminal, pastes text that arrives in chunks
+// with pauses and a resize in between, saves and checks the file.
+//
+// Usage: paste_test <path to lex>
+
+#define _XOPEN_SOURCE 600
+#define _DEFAULT_SOURCE
+
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Longer than the default ttimeoutlen of 50 ms
+#define PAUSE_MS 300
+
+static int master = -1;
+
+/**
+ * pump - Read the editor output until it has been quiet for a while
+ * @ms: Time to wait
+ */
+static void pump(int ms)
+{
+  char          buf[4096];
+  struct pollfd fd = {.fd = master, .events = POLLIN};
+  while (poll(&fd, 1, ms) > 0)
+  {
+    if (read(master, buf, sizeof(buf)) <= 0)
+      return;
+  }
+}
+
+static void sendKeys(const char *s, int ms)
+{
+  size_t len = strlen(s);
+  while (len)
+  {
+    ssize_t n = write(master, s, len);
+    if (n <= 0)
+      return;
+    s += n;
+    len -= n;
+  }
+  pump(ms);
+}
+
+static void resize(int rows, int cols)
+{
+  struct winsize ws = {.ws_row = rows, .ws_col = cols};
+  ioctl(master, TIOCSWINSZ, &ws);
+}
+
+/**
+ * startEditor - Run the editor on a file in a new pseudo terminal
+ * @lex: Path of the editor
+ * @home: HOME of the editor, keeps the user config out
+ * @path: The file
+ *
+ * Returns: Process id of the editor, -1 on error
+ */
+static pid_t startEditor(const char *lex, const char *home, const char *path)
+{
+  master = posix_openpt(O_RDWR | O_NOCTTY);
+  if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0)
+    return -1;
+  const char *slave_name = ptsname(master);
+  if (!slave_name)
+    return -1;
+
+  resize(24, 80);
+  pid_t pid = fork();
+  if (pid != 0)
+    return pid;
+
+  setsid();
+  int slave = open(slave_name, O_RDWR);
+  if (slave < 0)
+    _exit(127);
+  ioctl(slave, TIOCSCTTY, 0);
+  dup2(slave, STDIN_FILENO);
+  dup2(slave, STDOUT_FILENO);
+  dup2(slave, STDERR_FILENO);
+  close(slave);
+  close(master);
+
+  setenv("HOME", home, 1);
+  setenv("TERM", "xterm-256color", 1);
+  execl(lex, lex, path, (char *) NULL);
+  _exit(127);
+}
+
+/**
+ * quitEditor - Quit the editor and wait for it to exit
+ * @pid: Process id of the editor
+ *
+ * Returns: true if the editor exited normally within five seconds
+ */
+static bool quitEditor(pid_t pid)
+{
+  sendKeys("\x18", 100);
+  for (int i = 0; i < 50; i++)
+  {
+    int status;
+    if (waitpid(pid, &status, WNOHANG) == pid)
+      return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    // The terminal is closed once the editor is done, pump won't wait
+    usleep(100 * 1000);
+  }
+  kill(pid, SIGKILL);
+  waitpid(pid, NULL, 0);
+  return false;
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc != 2)
+  {
+    fprintf(stderr, "Usage: %s <path to lex>\n", argv[0]);
+    return 1;
+  }
+
+  char dir[] = "/tmp/lex-paste-XXXXXX";
+  if (!mkdtemp(dir))
+  {
+    perror("mkdtemp");
+    return 1;
+  }
+  char path[64];
+  snprintf(path, sizeof(path), "%s/paste.txt", dir);
+  FILE *fp = fopen(path, "w");
+  if (!fp)
+  {
+    perror(path);
+    return 1;
+  }
+  fclose(fp);
+
+  pid_t pid = startEditor(argv[1], dir, path);
+  if (pid < 0)
+  {
+    perror("pseudo terminal");
+    return 1;
+  }
+  pump(800);
+
+  // The paste stalls after a chunk, on a resize and inside the end marker
+  sendKeys("\x1b[200~first line\nsec", PAUSE_MS);
+  resize(30, 100);
+  pump(PAUSE_MS);
+  sendKeys("ond half\r\nthird\x1b", PAUSE_MS);
+  sendKeys("[201~", PAUSE_MS);
+
+  // Save, then confirm the message
+  sendKeys("\x0f", 500);
+  sendKeys("\r", 300);
+  bool exited = quitEditor(pid);
+
+  static const char expected[] = "first line\nsecond half\nthird";
+  char              got[256]   = {0};
+  fp                           = fopen(path, "r");
+  if (fp)
+  {
+    size_t n = fread(got, 1, sizeof(got) - 1, fp);
+    got[n]   = '\0';
+    fclose(fp);
+  }
+  remove(path);
+  rmdir(dir);
+
+  if (!exited)
+    fprintf(stderr, "The editor didn't exit.\n");
+  if (strcmp(got, expected) != 0)
+  {
+    fprintf(stderr, "Pasted text mismatch.\nExpected: \"%s\"\nGot:      \"%s\"\n", expected, got);
+    return 1;
+  }
+  return exited ? 0 : 1;
+}